@@ -26,8 +26,11 @@
 
 #include <memory>
 
+#include <deque>
 #include <queue>
+#include <span>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <type_traits>
@@ -37,6 +40,59 @@
 #include <unordered_set>
 
 #include <algorithm>
+#include <concepts>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+/**
+ * @def NEKO_EVENT_ENABLE_EXCEPTIONS
+ * @brief Whether the event loop catches exceptions thrown by handlers and tasks.
+ * @details Detected from the compiler settings by default. Define it to 0 to build
+ * the library with -fno-exceptions; handlers then report errors through HandlerResult.
+ */
+#ifndef NEKO_EVENT_ENABLE_EXCEPTIONS
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define NEKO_EVENT_ENABLE_EXCEPTIONS 1
+#else
+#define NEKO_EVENT_ENABLE_EXCEPTIONS 0
+#endif
+#endif
+
+/**
+ * @def NEKO_EVENT_TIMESTAMP_SOURCE
+ * @brief Default TimestampSource of new event loops: None, Coarse, Tsc or Steady.
+ */
+#ifndef NEKO_EVENT_TIMESTAMP_SOURCE
+#define NEKO_EVENT_TIMESTAMP_SOURCE Steady
+#endif
+
+#if defined(__linux__)
+#include <time.h>
+#endif
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define NEKO_EVENT_HAS_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define NEKO_EVENT_HAS_TSC 1
+#endif
+
+/**
+ * @def NEKO_EVENT_DISABLE_SIMD
+ * @brief Define to use only the scalar fallback when evaluating predicate filters in bulk.
+ * @details Otherwise SSE2/AVX/AVX2 kernels are used when the compiler targets them.
+ */
+#if !defined(NEKO_EVENT_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define NEKO_EVENT_SIMD_SSE2 1
+#include <immintrin.h>
+#if defined(__AVX__)
+#define NEKO_EVENT_SIMD_AVX 1
+#endif
+#if defined(__AVX2__)
+#define NEKO_EVENT_SIMD_AVX2 1
+#endif
+#endif
 
 /**
  * @brief Event namespace
@@ -46,6 +102,7 @@ namespace neko::event {
 
     using TimePoint = std::chrono::steady_clock::time_point;
     using EventId = neko::uint64;
+    using Phase = neko::uint32; // Dispatch phase, see EventLoop::publishToPhase
     using HandlerId = neko::uint64;
 
     // Event statistics
@@ -54,42 +111,454 @@ namespace neko::event {
         neko::uint64 processedEvents = 0;
         neko::uint64 droppedEvents = 0;
         neko::uint64 failedEvents = 0;
+        neko::uint64 failedHandlerCalls = 0;
+        neko::uint64 discardedEvents = 0;      // Left in the queue at shutdown
+        neko::uint64 cascadeLimitedEvents = 0; // Dropped for exceeding the maximum cascade depth
+        neko::uint64 cascadeCycles = 0;        // Type cycles detected in event cascades
+        neko::uint32 maxCascadeDepth = 0;      // Deepest cascade observed
+        neko::uint64 rateLimitedEvents = 0;    // Rejected or dropped by the rate limit of their type
+        neko::uint64 delayedEvents = 0;        // Deferred by the rate limit of their type
+        neko::uint64 rateLimitedCalls = 0;     // Handler invocations skipped by a handler rate limit
         std::chrono::milliseconds avgProcessingTime{0};
         std::chrono::milliseconds maxProcessingTime{0};
     };
 
+    // List of base payload types, see EventBases
+    template <typename... Bases>
+    struct BaseTypes {};
+
+    /**
+     * @brief Base payload types of an event type, for polymorphic dispatch.
+     * @details Handlers subscribed to a base type also receive events of derived types.
+     * Declare the bases either with a member `using EventBases = BaseTypes<Base...>;`
+     * or by specializing this trait. Bases of bases are followed transitively.
+     */
+    template <typename T>
+    struct EventBases {
+        using type = BaseTypes<>;
+    };
+
+    template <typename T>
+        requires requires { typename T::EventBases; }
+    struct EventBases<T> {
+        using type = typename T::EventBases;
+    };
+
+    // Lifecycle of an event loop
+    enum class LoopState : neko::uint8 {
+        Created,  // Constructed, never run
+        Running,  // At least one thread is inside run() or runFor()
+        Draining, // Stopping, the last runner is draining queued work
+        Stopped   // No thread is running the loop; run() may be called again after restart()
+    };
+
+    // What happens to queued work when the event loop stops
+    enum class ShutdownMode : neko::uint8 {
+        Immediate, // Discard queued events
+        Drain,     // Process queued events, and those they publish, before stopping
+        DrainAll   // Like Drain, also running tasks that are due
+    };
+
+    // Policy applied when the event queue is full
+    enum class OverflowPolicy : neko::uint8 {
+        DropNewest, // Drop the event being published
+        DropOldest  // Evict queued events, oldest first, to make room
+    };
+
+    // What happens to an event published beyond the rate limit of its type
+    enum class RateLimitPolicy : neko::uint8 {
+        Reject, // Drop it, logging it and adding it to the dead-letter queue
+        Drop,   // Drop it silently, only counting it
+        Delay   // Publish it once the rate allows, or drop it if that is later than the maximum delay
+    };
+
+    // Token bucket rate limit
+    struct RateLimit {
+        double eventsPerSecond = 0; // Sustained rate, 0 or less removes the limit
+        neko::uint64 burst = 1;     // Events allowed at once, the bucket size
+        RateLimitPolicy policy = RateLimitPolicy::Reject;
+        std::chrono::milliseconds maxDelay{1000}; // Longest deferral under RateLimitPolicy::Delay
+    };
+
+    /**
+     * @brief Memory footprint of an event payload, used by the queue byte budget.
+     * @details The default counts sizeof(T). Specialize it for payloads owning heap memory
+     * or to add a user-specified amount of extra bytes.
+     */
+    template <typename T>
+    struct PayloadSize {
+        static neko::uint64 of(const T &) {
+            return sizeof(T);
+        }
+    };
+
+    template <typename CharT, typename Traits, typename Alloc>
+    struct PayloadSize<std::basic_string<CharT, Traits, Alloc>> {
+        static neko::uint64 of(const std::basic_string<CharT, Traits, Alloc> &value) {
+            return sizeof(value) + value.capacity() * sizeof(CharT);
+        }
+    };
+
+    template <typename U, typename Alloc>
+    struct PayloadSize<std::vector<U, Alloc>> {
+        static neko::uint64 of(const std::vector<U, Alloc> &value) {
+            return sizeof(value) + value.capacity() * sizeof(U);
+        }
+    };
+
+    /**
+     * @brief Column layout of an event type, opting it into columnar (structure-of-arrays) buffering.
+     * @details Specialize it with the fields to store, each in its own contiguous array:
+     * `template <> struct ColumnLayout<Tick> { static constexpr auto fields = std::make_tuple(&Tick::id, &Tick::price); };`
+     * The type must be trivially copyable and default constructible; fields left out of the layout
+     * are value-initialized when rows are turned back into objects.
+     */
+    template <typename T>
+    struct ColumnLayout {};
+
+    template <typename T>
+    concept ColumnarType = requires { ColumnLayout<T>::fields; } &&
+                           std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>;
+
+    namespace detail {
+        template <typename Fields>
+        struct ColumnTypes;
+
+        template <typename T, typename... F>
+        struct ColumnTypes<std::tuple<F T::*...>> {
+            using Vectors = std::tuple<std::vector<F>...>;
+            using Spans = std::tuple<std::span<const F>...>;
+        };
+
+        template <typename T>
+        using ColumnFields = std::remove_cv_t<decltype(ColumnLayout<T>::fields)>;
+
+        template <typename T>
+        using ColumnVectors = typename ColumnTypes<ColumnFields<T>>::Vectors;
+
+        /**
+         * @brief Get the position of a field in the column layout of T.
+         * @tparam Member The field, e.g. &Tick::price.
+         */
+        template <typename T, auto Member, std::size_t I = 0>
+        constexpr std::size_t columnIndex() {
+            static_assert(I < std::tuple_size_v<ColumnFields<T>>, "The field is not part of the ColumnLayout");
+            if constexpr (std::is_same_v<std::tuple_element_t<I, ColumnFields<T>>, decltype(Member)>) {
+                if constexpr (std::get<I>(ColumnLayout<T>::fields) == Member) {
+                    return I;
+                } else {
+                    return columnIndex<T, Member, I + 1>();
+                }
+            } else {
+                return columnIndex<T, Member, I + 1>();
+            }
+        }
+
+        template <typename T, std::size_t... I>
+        void appendRow(ColumnVectors<T> &columns, const T &row, std::index_sequence<I...>) {
+            (std::get<I>(columns).push_back(row.*std::get<I>(ColumnLayout<T>::fields)), ...);
+        }
+
+        /**
+         * @brief Append the fields of a row to column arrays.
+         * @param columns The column arrays.
+         * @param row The row.
+         */
+        template <typename T>
+        void appendRow(ColumnVectors<T> &columns, const T &row) {
+            appendRow(columns, row, std::make_index_sequence<std::tuple_size_v<ColumnVectors<T>>>{});
+        }
+
+        /**
+         * @brief Allocate the next dense event type ordinal.
+         * @return The ordinal, unique within the process.
+         */
+        inline std::size_t nextTypeOrdinal() {
+            static std::atomic<std::size_t> counter{0};
+            return counter.fetch_add(1);
+        }
+
+        /**
+         * @brief Get the dense ordinal of an event type, used to index handler registries.
+         * @tparam T The event data type.
+         * @return The ordinal of T.
+         */
+        template <typename T>
+        std::size_t typeOrdinal() {
+            static const std::size_t ordinal = nextTypeOrdinal();
+            return ordinal;
+        }
+    } // namespace detail
+
+    // Source of event timestamps and processing-time statistics
+    enum class TimestampSource : neko::uint8 {
+        None,   // No timestamps; processing times are not measured
+        Coarse, // CLOCK_MONOTONIC_COARSE on Linux (a few ms resolution), steady_clock elsewhere
+        Tsc,    // Calibrated CPU time-stamp counter on x86 (requires an invariant TSC), steady_clock elsewhere
+        Steady  // std::chrono::steady_clock
+    };
+
+    namespace detail {
+#if defined(NEKO_EVENT_HAS_TSC)
+        // Conversion of time-stamp counter ticks to steady_clock time, measured once per process
+        struct TscCalibration {
+            double nsPerTick = 0;
+            neko::uint64 baseTicks = 0;
+            TimePoint baseTime;
+
+            TscCalibration() {
+                auto start = std::chrono::steady_clock::now();
+                neko::uint64 startTicks = __rdtsc();
+                TimePoint end;
+                do {
+                    end = std::chrono::steady_clock::now();
+                } while (end - start < std::chrono::milliseconds(5));
+                baseTicks = __rdtsc();
+                baseTime = end;
+                nsPerTick = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) /
+                            static_cast<double>(baseTicks - startTicks);
+            }
+        };
+
+        inline const TscCalibration &tscCalibration() {
+            static const TscCalibration calibration;
+            return calibration;
+        }
+#endif
+
+        /**
+         * @brief Read the current time from a timestamp source.
+         * @param source The source.
+         * @return The time, or an empty TimePoint for TimestampSource::None.
+         */
+        inline TimePoint timestampNow(TimestampSource source) {
+            switch (source) {
+                case TimestampSource::None:
+                    return TimePoint{};
+                case TimestampSource::Coarse: {
+#if defined(__linux__) && defined(CLOCK_MONOTONIC_COARSE)
+                    timespec ts;
+                    clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+                    return TimePoint(std::chrono::duration_cast<TimePoint::duration>(
+                        std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec)));
+#else
+                    return std::chrono::steady_clock::now();
+#endif
+                }
+                case TimestampSource::Tsc: {
+#if defined(NEKO_EVENT_HAS_TSC)
+                    const auto &calibration = tscCalibration();
+                    auto ticks = static_cast<neko::int64>(__rdtsc() - calibration.baseTicks);
+                    return calibration.baseTime + std::chrono::duration_cast<TimePoint::duration>(
+                                                      std::chrono::nanoseconds(static_cast<neko::int64>(ticks * calibration.nsPerTick)));
+#else
+                    return std::chrono::steady_clock::now();
+#endif
+                }
+                default:
+                    return std::chrono::steady_clock::now();
+            }
+        }
+    } // namespace detail
+
     // Base event class
     class BaseEvent {
     public:
-        EventId id;
-        TimePoint timestamp;
+        EventId id;           // Unique within the process, assigned when the event is published
+        EventId parentId = 0; // Event being dispatched when this one was published, 0 if none
+        EventId rootId = 0;   // First event of the causal chain, the event itself if it has no parent
+        neko::uint32 depth = 0; // Number of ancestors in the causal chain
+        TimePoint timestamp;  // Publish time from the loop's TimestampSource, empty for TimestampSource::None
         neko::Priority priority;
         neko::SyncMode mode;
+        neko::uint32 retryCount = 0;
+        neko::uint64 byteSize = 0;      // Accounted against the queue byte budget
+        std::size_t typeOrdinal = 0;    // detail::typeOrdinal of the payload type, set by derived classes
 
         BaseEvent(neko::Priority prio = neko::Priority::Normal, neko::SyncMode procMode = neko::SyncMode::Async)
-            : id(0), timestamp(std::chrono::steady_clock::now()), priority(prio), mode(procMode) {}
+            : id(0), timestamp(), priority(prio), mode(procMode) {}
         virtual ~BaseEvent() = default;
         virtual std::type_index getType() const = 0;
+        /**
+         * @brief Get a pointer to the event data.
+         * @return Pointer to the payload, of the type returned by getType().
+         */
+        virtual const void *payload() const = 0;
     };
 
+    namespace detail {
+        /**
+         * @brief Allocate a unique event ID.
+         * @return The ID, never 0.
+         * @details Each thread reserves a block of IDs from the global counter, so publishing
+         * does not contend on a shared atomic.
+         */
+        inline EventId nextEventId() {
+            constexpr EventId blockSize = 1024;
+            static std::atomic<EventId> counter{1};
+            thread_local EventId next = 0;
+            thread_local EventId end = 0;
+            if (next == end) {
+                next = counter.fetch_add(blockSize, std::memory_order_relaxed);
+                end = next + blockSize;
+            }
+            return next++;
+        }
+
+        /**
+         * @brief Get the event being dispatched on the calling thread.
+         * @return Reference to the current event pointer, null outside of dispatch.
+         */
+        inline const BaseEvent *&currentDispatch() {
+            thread_local const BaseEvent *event = nullptr;
+            return event;
+        }
+
+        // Marks an event as being dispatched on the calling thread, restoring the previous one on exit
+        class DispatchScope {
+        private:
+            const BaseEvent *previous;
+
+        public:
+            explicit DispatchScope(const BaseEvent *event) : previous(currentDispatch()) {
+                currentDispatch() = event;
+            }
+            ~DispatchScope() {
+                currentDispatch() = previous;
+            }
+            DispatchScope(const DispatchScope &) = delete;
+            DispatchScope &operator=(const DispatchScope &) = delete;
+        };
+
+        /**
+         * @brief Assign an ID to an event and link it to the event being dispatched, if any.
+         * @param event The event, left unchanged if it already has an ID (e.g. when retried).
+         */
+        inline void stampEvent(BaseEvent &event) {
+            if (event.id != 0)
+                return;
+            event.id = nextEventId();
+            if (const BaseEvent *parent = currentDispatch()) {
+                event.parentId = parent->id;
+                event.rootId = parent->rootId != 0 ? parent->rootId : parent->id;
+                event.depth = parent->depth + 1;
+            } else {
+                event.rootId = event.id;
+            }
+        }
+
+        /**
+         * @class RateLimiter
+         * @brief Lock-free token bucket, implemented with the generic cell rate algorithm (GCRA).
+         * @details Instead of a token count and a refill time, the bucket is a single theoretical
+         * arrival time (TAT) that each admitted event pushes forward by the time per token. An event
+         * conforms while the TAT is at most the burst tolerance ahead of now, so admitting one is a
+         * single compare-and-swap. The settings are atomics and can be changed while in use.
+         */
+        class RateLimiter {
+        private:
+            std::atomic<TimePoint::rep> tat{0};
+            std::atomic<TimePoint::rep> interval{0};  // Time per token, 0 when unlimited
+            std::atomic<TimePoint::rep> tolerance{0}; // interval * (burst - 1)
+            std::atomic<TimePoint::rep> maxDelay{0};
+            std::atomic<RateLimitPolicy> policy{RateLimitPolicy::Reject};
+
+        public:
+            /**
+             * @brief Apply a rate limit.
+             * @param limit The limit.
+             */
+            void configure(const RateLimit &limit) {
+                TimePoint::rep step = 0;
+                if (limit.eventsPerSecond > 0) {
+                    auto perToken = std::chrono::duration<double>(1.0 / limit.eventsPerSecond);
+                    step = std::max<TimePoint::rep>(1, std::chrono::duration_cast<TimePoint::duration>(perToken).count());
+                }
+                tolerance.store(step * static_cast<TimePoint::rep>(std::max<neko::uint64>(limit.burst, 1) - 1), std::memory_order_relaxed);
+                maxDelay.store(std::chrono::duration_cast<TimePoint::duration>(limit.maxDelay).count(), std::memory_order_relaxed);
+                policy.store(limit.policy, std::memory_order_relaxed);
+                interval.store(step, std::memory_order_release);
+            }
+
+            bool limited() const {
+                return interval.load(std::memory_order_acquire) != 0;
+            }
+
+            RateLimitPolicy getPolicy() const {
+                return policy.load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Take a token if one is available.
+             * @param now The current time.
+             * @return True if the event conforms to the limit.
+             */
+            bool tryAcquire(TimePoint now) {
+                auto step = interval.load(std::memory_order_acquire);
+                if (step == 0)
+                    return true;
+                auto tau = tolerance.load(std::memory_order_relaxed);
+                auto time = now.time_since_epoch().count();
+                auto current = tat.load(std::memory_order_relaxed);
+                for (;;) {
+                    if (current - tau > time)
+                        return false;
+                    if (tat.compare_exchange_weak(current, std::max(current, time) + step, std::memory_order_acq_rel, std::memory_order_relaxed))
+                        return true;
+                }
+            }
+
+            /**
+             * @brief Reserve the next token, possibly in the future.
+             * @param now The current time.
+             * @return When the reserved token becomes available, or nullopt if that is beyond the maximum delay.
+             */
+            std::optional<TimePoint> reserve(TimePoint now) {
+                auto step = interval.load(std::memory_order_acquire);
+                if (step == 0)
+                    return now;
+                auto tau = tolerance.load(std::memory_order_relaxed);
+                auto limit = maxDelay.load(std::memory_order_relaxed);
+                auto time = now.time_since_epoch().count();
+                auto current = tat.load(std::memory_order_relaxed);
+                for (;;) {
+                    auto release = std::max(time, current - tau);
+                    if (release - time > limit)
+                        return std::nullopt;
+                    if (tat.compare_exchange_weak(current, std::max(current, release) + step, std::memory_order_acq_rel, std::memory_order_relaxed))
+                        return TimePoint(TimePoint::duration(release));
+                }
+            }
+        };
+    } // namespace detail
+
     // Templated event class
     template <typename T>
     class Event : public BaseEvent {
     public:
         T data;
 
-        Event() : data(T{}) {}
+        Event() : data(T{}) {
+            byteSize = sizeof(Event) + PayloadSize<T>::of(data);
+            typeOrdinal = detail::typeOrdinal<T>();
+        }
 
         /**
          * @brief Construct an Event with event data.
          * @param eventData The event data.
          */
-        Event(const T &eventData) : data(eventData) {}
+        Event(const T &eventData) : data(eventData) {
+            byteSize = sizeof(Event) + PayloadSize<T>::of(data);
+            typeOrdinal = detail::typeOrdinal<T>();
+        }
         /**
          * @brief Construct an Event with event data (move).
          * @param eventData The event data (rvalue).
          */
-        Event(T &&eventData) : data(std::move(eventData)) {}
+        Event(T &&eventData) : data(std::move(eventData)) {
+            byteSize = sizeof(Event) + PayloadSize<T>::of(data);
+            typeOrdinal = detail::typeOrdinal<T>();
+        }
 
         /**
          * @brief Get the type index of the event data.
@@ -98,356 +567,3221 @@ namespace neko::event {
         std::type_index getType() const override {
             return std::type_index(typeid(T));
         }
+
+        const void *payload() const override {
+            return &data;
+        }
     };
 
-    // Event filter interface
+    // Event sharing an immutable payload instead of owning a copy
     template <typename T>
-    class EventFilter {
+    class SharedEvent : public BaseEvent {
     public:
-        virtual ~EventFilter() = default;
+        std::shared_ptr<const T> data;
+
         /**
-         * @brief Determine whether the event data should be processed.
-         * @param eventData The event data.
-         * @return True if should process, false otherwise.
+         * @brief Construct a SharedEvent referencing the payload.
+         * @param eventData The shared payload, must not be null.
          */
-        virtual bool shouldProcess(const T &eventData) = 0;
+        SharedEvent(std::shared_ptr<const T> eventData) : data(std::move(eventData)) {
+            byteSize = sizeof(SharedEvent) + PayloadSize<T>::of(*data);
+            typeOrdinal = detail::typeOrdinal<T>();
+        }
+
+        /**
+         * @brief Get the type index of the event data.
+         * @return The type index.
+         */
+        std::type_index getType() const override {
+            return std::type_index(typeid(T));
+        }
+
+        const void *payload() const override {
+            return data.get();
+        }
     };
 
-    // Event handler interface
-    class BaseEventHandler {
+    // Event whose payload is built by a factory when a handler first reads it
+    template <typename T, typename Factory>
+    class LazyEvent : public BaseEvent {
+    private:
+        mutable Factory factory;
+        mutable std::optional<T> data;
+        mutable std::once_flag built;
+
     public:
-        HandlerId id;
-        virtual ~BaseEventHandler() = default;
         /**
-         * @brief Handle the event.
-         * @param event The event to handle.
+         * @brief Construct a LazyEvent.
+         * @param payloadFactory Callable returning the payload, invoked at most once.
+         * @note The byte size cannot include heap memory of the payload since it is not built yet.
          */
-        virtual void handle(const std::shared_ptr<BaseEvent> &event) = 0;
+        explicit LazyEvent(Factory payloadFactory) : factory(std::move(payloadFactory)) {
+            byteSize = sizeof(LazyEvent);
+            typeOrdinal = detail::typeOrdinal<T>();
+        }
+
         /**
-         * @brief Get the type index of the event this handler handles.
+         * @brief Get the type index of the event data.
          * @return The type index.
          */
-        virtual std::type_index getEventType() const = 0;
+        std::type_index getType() const override {
+            return std::type_index(typeid(T));
+        }
+
+        /**
+         * @brief Get the payload, building it on first access.
+         * @details Concurrent handlers wait for a single construction. If the factory throws,
+         * the next access tries again.
+         */
+        const void *payload() const override {
+            std::call_once(built, [this]() { data.emplace(factory()); });
+            return &*data;
+        }
     };
 
-    // Enhanced event handler with filters
+    /**
+     * @class PayloadPool
+     * @brief Pool of reusable payload buffers for shared events.
+     * @details acquire() hands out a shared_ptr whose deleter returns the buffer to the pool
+     * once the last reader (handler, forwarded event or deferred task) releases it.
+     * Returned buffers keep their previous contents and are not reset.
+     */
     template <typename T>
-    class EventHandler : public BaseEventHandler {
+    class PayloadPool {
     private:
-        std::function<void(const T &)> callback;
-        std::vector<std::unique_ptr<EventFilter<T>>> filters;
-        neko::Priority minPriority = neko::Priority::Low;
+        struct State {
+            std::mutex mtx;
+            std::vector<std::unique_ptr<T>> freeList;
+            std::size_t capacity;
+        };
+        std::shared_ptr<State> state;
 
     public:
         /**
-         * @brief Construct an EventHandler with a callback.
-         * @param cb The callback function.
+         * @brief Construct a pool.
+         * @param capacity The maximum number of idle buffers kept for reuse.
          */
-        EventHandler(std::function<void(const T &)> cb) : callback(std::move(cb)) {}
+        explicit PayloadPool(std::size_t capacity = 16) : state(std::make_shared<State>()) {
+            state->capacity = capacity;
+        }
 
         /**
-         * @brief Add a filter to this handler.
-         * @param filter The filter to add.
+         * @brief Take a buffer from the pool, allocating a new one if none is idle.
+         * @return The buffer, returned to the pool when the last reference is released.
          */
-        void addFilter(std::unique_ptr<EventFilter<T>> filter) {
-            filters.push_back(std::move(filter));
+        std::shared_ptr<T> acquire() {
+            std::unique_ptr<T> buffer;
+            {
+                std::lock_guard<std::mutex> lock(state->mtx);
+                if (!state->freeList.empty()) {
+                    buffer = std::move(state->freeList.back());
+                    state->freeList.pop_back();
+                }
+            }
+            if (!buffer) {
+                buffer = std::make_unique<T>();
+            }
+
+            std::weak_ptr<State> weakState = state;
+            return std::shared_ptr<T>(buffer.release(), [weakState](T *ptr) {
+                std::unique_ptr<T> owned(ptr);
+                if (auto pool = weakState.lock()) {
+                    std::lock_guard<std::mutex> lock(pool->mtx);
+                    if (pool->freeList.size() < pool->capacity) {
+                        pool->freeList.push_back(std::move(owned));
+                    }
+                }
+            });
         }
 
         /**
-         * @brief Set the minimum priority for this handler.
-         * @param priority The minimum priority.
+         * @brief Get the number of idle buffers in the pool.
+         * @return The number of idle buffers.
          */
-        void setMinPriority(neko::Priority priority) {
-            minPriority = priority;
+        std::size_t available() const {
+            std::lock_guard<std::mutex> lock(state->mtx);
+            return state->freeList.size();
         }
+    };
 
+    // Event filter interface
+    template <typename T>
+    class EventFilter {
+    public:
+        virtual ~EventFilter() = default;
         /**
-         * @brief Handle the event.
-         * @throws std::bad_cast if the event cannot be cast to Event<T>.
-         * @throws maybe throw other exceptions in the callback.
-         * @note The callback will only be invoked if the event's priority meets the minimum required priority
+         * @brief Determine whether the event data should be processed.
+         * @param eventData The event data.
+         * @return True if should process, false otherwise.
          */
-        void handle(const std::shared_ptr<BaseEvent> &event) override {
-            auto typedEvent = std::static_pointer_cast<Event<T>>(event);
+        virtual bool shouldProcess(const T &eventData) = 0;
+    };
 
-            // Check priority
-            if (static_cast<neko::uint8>(event->priority) < static_cast<neko::uint8>(minPriority)) {
-                return;
+    namespace detail::simd {
+        enum class CompareOp : neko::uint8 {
+            Less,
+            LessEqual,
+            Greater,
+            GreaterEqual,
+            Equal,
+            NotEqual
+        };
+
+        template <typename F>
+        void compareScalar(CompareOp op, const F *values, std::size_t count, F rhs, neko::uint8 *mask) {
+            switch (op) {
+                case CompareOp::Less:
+                    for (std::size_t i = 0; i < count; ++i)
+                        mask[i] = values[i] < rhs;
+                    break;
+                case CompareOp::LessEqual:
+                    for (std::size_t i = 0; i < count; ++i)
+                        mask[i] = values[i] <= rhs;
+                    break;
+                case CompareOp::Greater:
+                    for (std::size_t i = 0; i < count; ++i)
+                        mask[i] = values[i] > rhs;
+                    break;
+                case CompareOp::GreaterEqual:
+                    for (std::size_t i = 0; i < count; ++i)
+                        mask[i] = values[i] >= rhs;
+                    break;
+                case CompareOp::Equal:
+                    for (std::size_t i = 0; i < count; ++i)
+                        mask[i] = values[i] == rhs;
+                    break;
+                case CompareOp::NotEqual:
+                    for (std::size_t i = 0; i < count; ++i)
+                        mask[i] = values[i] != rhs;
+                    break;
             }
+        }
 
-            // Apply filters
-            for (const auto &filter : filters) {
-                if (!filter->shouldProcess(typedEvent->data)) {
-                    return;
+        // Expand the low lanes of a movemask result into one byte per lane
+        inline void storeBits(int bits, std::size_t lanes, neko::uint8 *mask) {
+            for (std::size_t lane = 0; lane < lanes; ++lane) {
+                mask[lane] = static_cast<neko::uint8>((bits >> lane) & 1);
+            }
+        }
+
+#if defined(NEKO_EVENT_SIMD_SSE2)
+        /**
+         * @brief Compare vectors lane by lane.
+         * @return The number of values processed, the remainder is left for the scalar loop.
+         */
+        inline std::size_t compareVector(CompareOp op, const double *values, std::size_t count, double rhs, neko::uint8 *mask) {
+            std::size_t i = 0;
+#if defined(NEKO_EVENT_SIMD_AVX)
+            const __m256d wideRhs = _mm256_set1_pd(rhs);
+            for (; i + 4 <= count; i += 4) {
+                __m256d lhs = _mm256_loadu_pd(values + i);
+                __m256d result;
+                switch (op) {
+                    case CompareOp::Less: result = _mm256_cmp_pd(lhs, wideRhs, _CMP_LT_OQ); break;
+                    case CompareOp::LessEqual: result = _mm256_cmp_pd(lhs, wideRhs, _CMP_LE_OQ); break;
+                    case CompareOp::Greater: result = _mm256_cmp_pd(lhs, wideRhs, _CMP_GT_OQ); break;
+                    case CompareOp::GreaterEqual: result = _mm256_cmp_pd(lhs, wideRhs, _CMP_GE_OQ); break;
+                    case CompareOp::Equal: result = _mm256_cmp_pd(lhs, wideRhs, _CMP_EQ_OQ); break;
+                    default: result = _mm256_cmp_pd(lhs, wideRhs, _CMP_NEQ_UQ); break;
+                }
+                storeBits(_mm256_movemask_pd(result), 4, mask + i);
+            }
+#endif
+            const __m128d narrowRhs = _mm_set1_pd(rhs);
+            for (; i + 2 <= count; i += 2) {
+                __m128d lhs = _mm_loadu_pd(values + i);
+                __m128d result;
+                switch (op) {
+                    case CompareOp::Less: result = _mm_cmplt_pd(lhs, narrowRhs); break;
+                    case CompareOp::LessEqual: result = _mm_cmple_pd(lhs, narrowRhs); break;
+                    case CompareOp::Greater: result = _mm_cmpgt_pd(lhs, narrowRhs); break;
+                    case CompareOp::GreaterEqual: result = _mm_cmpge_pd(lhs, narrowRhs); break;
+                    case CompareOp::Equal: result = _mm_cmpeq_pd(lhs, narrowRhs); break;
+                    default: result = _mm_cmpneq_pd(lhs, narrowRhs); break;
+                }
+                storeBits(_mm_movemask_pd(result), 2, mask + i);
+            }
+            return i;
+        }
+
+        inline std::size_t compareVector(CompareOp op, const float *values, std::size_t count, float rhs, neko::uint8 *mask) {
+            std::size_t i = 0;
+#if defined(NEKO_EVENT_SIMD_AVX)
+            const __m256 wideRhs = _mm256_set1_ps(rhs);
+            for (; i + 8 <= count; i += 8) {
+                __m256 lhs = _mm256_loadu_ps(values + i);
+                __m256 result;
+                switch (op) {
+                    case CompareOp::Less: result = _mm256_cmp_ps(lhs, wideRhs, _CMP_LT_OQ); break;
+                    case CompareOp::LessEqual: result = _mm256_cmp_ps(lhs, wideRhs, _CMP_LE_OQ); break;
+                    case CompareOp::Greater: result = _mm256_cmp_ps(lhs, wideRhs, _CMP_GT_OQ); break;
+                    case CompareOp::GreaterEqual: result = _mm256_cmp_ps(lhs, wideRhs, _CMP_GE_OQ); break;
+                    case CompareOp::Equal: result = _mm256_cmp_ps(lhs, wideRhs, _CMP_EQ_OQ); break;
+                    default: result = _mm256_cmp_ps(lhs, wideRhs, _CMP_NEQ_UQ); break;
+                }
+                storeBits(_mm256_movemask_ps(result), 8, mask + i);
+            }
+#endif
+            const __m128 narrowRhs = _mm_set1_ps(rhs);
+            for (; i + 4 <= count; i += 4) {
+                __m128 lhs = _mm_loadu_ps(values + i);
+                __m128 result;
+                switch (op) {
+                    case CompareOp::Less: result = _mm_cmplt_ps(lhs, narrowRhs); break;
+                    case CompareOp::LessEqual: result = _mm_cmple_ps(lhs, narrowRhs); break;
+                    case CompareOp::Greater: result = _mm_cmpgt_ps(lhs, narrowRhs); break;
+                    case CompareOp::GreaterEqual: result = _mm_cmpge_ps(lhs, narrowRhs); break;
+                    case CompareOp::Equal: result = _mm_cmpeq_ps(lhs, narrowRhs); break;
+                    default: result = _mm_cmpneq_ps(lhs, narrowRhs); break;
                 }
+                storeBits(_mm_movemask_ps(result), 4, mask + i);
             }
+            return i;
+        }
 
-            callback(typedEvent->data);
+        inline std::size_t compareVector(CompareOp op, const neko::int32 *values, std::size_t count, neko::int32 rhs, neko::uint8 *mask) {
+            std::size_t i = 0;
+            // Integer compares only provide greater-than and equality, the rest is derived by swapping or inverting
+            bool invert = op == CompareOp::LessEqual || op == CompareOp::GreaterEqual || op == CompareOp::NotEqual;
+#if defined(NEKO_EVENT_SIMD_AVX2)
+            const __m256i wideRhs = _mm256_set1_epi32(rhs);
+            for (; i + 8 <= count; i += 8) {
+                __m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + i));
+                __m256i result;
+                switch (op) {
+                    case CompareOp::Less:
+                    case CompareOp::GreaterEqual: result = _mm256_cmpgt_epi32(wideRhs, lhs); break;
+                    case CompareOp::Greater:
+                    case CompareOp::LessEqual: result = _mm256_cmpgt_epi32(lhs, wideRhs); break;
+                    default: result = _mm256_cmpeq_epi32(lhs, wideRhs); break;
+                }
+                int bits = _mm256_movemask_ps(_mm256_castsi256_ps(result));
+                storeBits(invert ? ~bits : bits, 8, mask + i);
+            }
+#endif
+            const __m128i narrowRhs = _mm_set1_epi32(rhs);
+            for (; i + 4 <= count; i += 4) {
+                __m128i lhs = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + i));
+                __m128i result;
+                switch (op) {
+                    case CompareOp::Less:
+                    case CompareOp::GreaterEqual: result = _mm_cmpgt_epi32(narrowRhs, lhs); break;
+                    case CompareOp::Greater:
+                    case CompareOp::LessEqual: result = _mm_cmpgt_epi32(lhs, narrowRhs); break;
+                    default: result = _mm_cmpeq_epi32(lhs, narrowRhs); break;
+                }
+                int bits = _mm_movemask_ps(_mm_castsi128_ps(result));
+                storeBits(invert ? ~bits : bits, 4, mask + i);
+            }
+            return i;
         }
+#endif
 
         /**
-         * @brief Get the type index of the event this handler handles.
-         * @return The type index.
+         * @brief Compare each value against rhs, writing 1 or 0 per value into mask.
+         * @details Uses SIMD kernels for double, float and int32 when available, a scalar loop otherwise.
          */
-        std::type_index getEventType() const override {
-            return std::type_index(typeid(T));
+        template <typename F>
+        void compare(CompareOp op, const F *values, std::size_t count, F rhs, neko::uint8 *mask) {
+            std::size_t done = 0;
+#if defined(NEKO_EVENT_SIMD_SSE2)
+            if constexpr (std::is_same_v<F, double> || std::is_same_v<F, float> || std::is_same_v<F, neko::int32>) {
+                done = compareVector(op, values, count, rhs, mask);
+            }
+#endif
+            compareScalar(op, values + done, count - done, rhs, mask + done);
         }
-    };
+    } // namespace detail::simd
 
-    // scheduled task
-    struct ScheduledTask {
-        TimePoint execTime;
-        std::function<void()> callback;
-        EventId id;
-        neko::Priority priority;
+    namespace detail {
+        /**
+         * @brief Scratch vector borrowed from a per-thread pool for the duration of a scope.
+         * @details Returned cleared but with its capacity, so steady-state use does not allocate.
+         * Nested borrows of the same type take different vectors.
+         */
+        template <typename V>
+        class ScratchVector {
+        private:
+            static std::vector<V> &pool() {
+                thread_local std::vector<V> free;
+                return free;
+            }
+
+        public:
+            V vector;
+
+            ScratchVector() {
+                auto &free = pool();
+                if (!free.empty()) {
+                    vector = std::move(free.back());
+                    free.pop_back();
+                }
+            }
+            ScratchVector(const ScratchVector &) = delete;
+            ScratchVector &operator=(const ScratchVector &) = delete;
+            ~ScratchVector() {
+                vector.clear();
+                pool().push_back(std::move(vector));
+            }
+        };
+    } // namespace detail
+
+    // Event filter that can also be evaluated in bulk over contiguous event data
+    template <typename T>
+    class BatchFilter : public EventFilter<T> {
+    public:
+        using value_type = T;
+
+        /**
+         * @brief Evaluate the filter for a batch of event data.
+         * @param items The event data.
+         * @param mask Output, one byte per item: 1 to process the item, 0 to skip it.
+         */
+        virtual void evaluate(std::span<const T> items, neko::uint8 *mask) const = 0;
+
+        /**
+         * @brief Evaluate the filter for a single item.
+         * @param eventData The event data.
+         * @return True to process the item.
+         * @note Evaluates a batch of one by default; override it to skip the bulk setup.
+         */
+        virtual bool test(const T &eventData) const {
+            neko::uint8 selected = 0;
+            evaluate(std::span<const T>(&eventData, 1), &selected);
+            return selected != 0;
+        }
+
+        bool shouldProcess(const T &eventData) override {
+            return test(eventData);
+        }
+    };
+
+    // Comparison of a numeric field against a constant, see field()
+    template <typename T, typename F>
+    class FieldPredicate final : public BatchFilter<T> {
+    private:
+        F T::*member;
+        detail::simd::CompareOp op;
+        F value;
+
+    public:
+        FieldPredicate(F T::*fieldMember, detail::simd::CompareOp compareOp, F rhs)
+            : member(fieldMember), op(compareOp), value(rhs) {}
+
+        /**
+         * @brief Evaluate the predicate over a column of field values.
+         * @param column The field values.
+         * @param mask Output, one byte per value.
+         */
+        void evaluateColumn(std::span<const F> column, neko::uint8 *mask) const {
+            detail::simd::compare(op, column.data(), column.size(), value, mask);
+        }
+
+        void evaluate(std::span<const T> items, neko::uint8 *mask) const override {
+            // Gather the field into a contiguous column so the comparison vectorizes
+            detail::ScratchVector<std::vector<F>> column;
+            column.vector.resize(items.size());
+            for (std::size_t i = 0; i < items.size(); ++i) {
+                column.vector[i] = items[i].*member;
+            }
+            evaluateColumn(column.vector, mask);
+        }
+
+        bool test(const T &eventData) const override {
+            neko::uint8 selected = 0;
+            detail::simd::compareScalar(op, &(eventData.*member), 1, value, &selected);
+            return selected != 0;
+        }
+
+        F T::*field() const {
+            return member;
+        }
+    };
+
+    // Membership test of a numeric field in a small set of constants, see field()
+    template <typename T, typename F>
+    class FieldInPredicate final : public BatchFilter<T> {
+    private:
+        F T::*member;
+        std::vector<F> values;
+
+    public:
+        FieldInPredicate(F T::*fieldMember, std::vector<F> candidates)
+            : member(fieldMember), values(std::move(candidates)) {}
+
+        void evaluateColumn(std::span<const F> column, neko::uint8 *mask) const {
+            std::fill(mask, mask + column.size(), neko::uint8{0});
+            detail::ScratchVector<std::vector<neko::uint8>> matches;
+            matches.vector.resize(column.size());
+            for (const auto &candidate : values) {
+                detail::simd::compare(detail::simd::CompareOp::Equal, column.data(), column.size(), candidate, matches.vector.data());
+                for (std::size_t i = 0; i < column.size(); ++i) {
+                    mask[i] |= matches.vector[i];
+                }
+            }
+        }
+
+        void evaluate(std::span<const T> items, neko::uint8 *mask) const override {
+            detail::ScratchVector<std::vector<F>> column;
+            column.vector.resize(items.size());
+            for (std::size_t i = 0; i < items.size(); ++i) {
+                column.vector[i] = items[i].*member;
+            }
+            evaluateColumn(column.vector, mask);
+        }
+
+        bool test(const T &eventData) const override {
+            return std::find(values.begin(), values.end(), eventData.*member) != values.end();
+        }
+
+        F T::*field() const {
+            return member;
+        }
+    };
+
+    // Conjunction or disjunction of two bulk filters
+    template <typename T, typename L, typename R, bool All>
+    class CombinedPredicate final : public BatchFilter<T> {
+    private:
+        L lhs;
+        R rhs;
+
+    public:
+        CombinedPredicate(L left, R right) : lhs(std::move(left)), rhs(std::move(right)) {}
+
+        void evaluate(std::span<const T> items, neko::uint8 *mask) const override {
+            lhs.evaluate(items, mask);
+            detail::ScratchVector<std::vector<neko::uint8>> other;
+            other.vector.resize(items.size());
+            rhs.evaluate(items, other.vector.data());
+            for (std::size_t i = 0; i < items.size(); ++i) {
+                mask[i] = All ? (mask[i] & other.vector[i]) : (mask[i] | other.vector[i]);
+            }
+        }
+
+        bool test(const T &eventData) const override {
+            return All ? (lhs.test(eventData) && rhs.test(eventData)) : (lhs.test(eventData) || rhs.test(eventData));
+        }
+    };
+
+    // Reference to a numeric event field, used to build bulk filters: field(&Tick::price) > 100.0
+    template <typename T, typename F>
+    class FieldRef {
+    private:
+        F T::*member;
+
+        FieldPredicate<T, F> make(detail::simd::CompareOp op, F value) const {
+            return FieldPredicate<T, F>(member, op, value);
+        }
+
+    public:
+        explicit FieldRef(F T::*fieldMember) : member(fieldMember) {}
+
+        FieldPredicate<T, F> operator<(F value) const { return make(detail::simd::CompareOp::Less, value); }
+        FieldPredicate<T, F> operator<=(F value) const { return make(detail::simd::CompareOp::LessEqual, value); }
+        FieldPredicate<T, F> operator>(F value) const { return make(detail::simd::CompareOp::Greater, value); }
+        FieldPredicate<T, F> operator>=(F value) const { return make(detail::simd::CompareOp::GreaterEqual, value); }
+        FieldPredicate<T, F> operator==(F value) const { return make(detail::simd::CompareOp::Equal, value); }
+        FieldPredicate<T, F> operator!=(F value) const { return make(detail::simd::CompareOp::NotEqual, value); }
+
+        /**
+         * @brief Build a membership test.
+         * @param values The accepted values.
+         * @return The predicate.
+         */
+        FieldInPredicate<T, F> in(std::initializer_list<F> values) const {
+            return FieldInPredicate<T, F>(member, std::vector<F>(values));
+        }
+    };
+
+    /**
+     * @brief Refer to a numeric field of an event type to build bulk-evaluated filters.
+     * @param member The field, e.g. &Tick::price.
+     * @return The field reference.
+     */
+    template <typename T, typename F>
+        requires std::is_arithmetic_v<F>
+    FieldRef<T, F> field(F T::*member) {
+        return FieldRef<T, F>(member);
+    }
+
+    template <typename L, typename R>
+        requires std::is_base_of_v<BatchFilter<typename L::value_type>, L> && std::is_base_of_v<BatchFilter<typename L::value_type>, R>
+    CombinedPredicate<typename L::value_type, L, R, true> operator&&(L lhs, R rhs) {
+        return {std::move(lhs), std::move(rhs)};
+    }
+
+    template <typename L, typename R>
+        requires std::is_base_of_v<BatchFilter<typename L::value_type>, L> && std::is_base_of_v<BatchFilter<typename L::value_type>, R>
+    CombinedPredicate<typename L::value_type, L, R, false> operator||(L lhs, R rhs) {
+        return {std::move(lhs), std::move(rhs)};
+    }
+
+    // Handler invocation status
+    enum class HandlerStatus : neko::uint8 {
+        Handled,  // The handler processed the event
+        Consumed, // The handler processed the event and stops propagation to later handlers
+        Filtered, // The event was skipped by the priority check or a filter
+        Failed    // The handler reported an error
+    };
+
+    // Result of a handler invocation, used to report errors without exceptions
+    struct HandlerResult {
+        HandlerStatus status = HandlerStatus::Handled;
+        std::string error;
+
+        static HandlerResult ok() {
+            return {};
+        }
+        static HandlerResult consumed() {
+            return {HandlerStatus::Consumed, {}};
+        }
+        static HandlerResult filtered() {
+            return {HandlerStatus::Filtered, {}};
+        }
+        static HandlerResult failure(std::string message) {
+            return {HandlerStatus::Failed, std::move(message)};
+        }
+
+        bool failed() const {
+            return status == HandlerStatus::Failed;
+        }
+    };
+
+    // Event handler interface
+    class BaseEventHandler {
+    public:
+        HandlerId id;
+        neko::Priority priority = neko::Priority::Normal; // Handlers with higher priority run first
+        std::atomic<bool> active{true};                   // Cleared on unsubscribe, dispatch skips inactive handlers
+        std::atomic<neko::int64> shots{-1};               // Invocations left, negative means unlimited
+        const BaseEventHandler *activeSource = this;      // Handler whose active flag applies, see UpcastEventHandler
+        std::atomic<detail::RateLimiter *> rateLimiter{nullptr}; // Set once by EventLoop::setHandlerRateLimit()
+        std::unique_ptr<detail::RateLimiter> rateLimiterOwner;
+        std::atomic<std::size_t> *subscriberCount = nullptr;     // Active handler count of its type, set on subscribe
+        virtual ~BaseEventHandler() = default;
+
+        detail::RateLimiter *limiter() const {
+            return activeSource->rateLimiter.load(std::memory_order_acquire);
+        }
+
+        bool isActive() const {
+            return activeSource->active.load(std::memory_order_acquire);
+        }
+
+        bool isLimited() const {
+            return activeSource->shots.load(std::memory_order_relaxed) >= 0;
+        }
+
+        /**
+         * @brief Deactivate the handler, on unsubscribe or when it expires by itself.
+         * @return True if this call deactivated it, false if it was already inactive.
+         */
+        bool deactivate() {
+            if (!active.exchange(false, std::memory_order_acq_rel))
+                return false;
+            if (subscriberCount) {
+                subscriberCount->fetch_sub(1, std::memory_order_release);
+            }
+            return true;
+        }
+
+        /**
+         * @brief Claim one invocation of a handler limited to a number of invocations.
+         * @return True if the handler may run, false if its invocations are used up.
+         * @details Taking the last invocation deactivates the handler.
+         */
+        bool takeShot() {
+            auto left = shots.load(std::memory_order_relaxed);
+            while (left > 0) {
+                if (shots.compare_exchange_weak(left, left - 1)) {
+                    if (left == 1) {
+                        deactivate();
+                    }
+                    return true;
+                }
+            }
+            return left < 0;
+        }
+
+        /**
+         * @brief Handle the event.
+         * @param event The event to handle.
+         * @return The result of the invocation.
+         */
+        virtual HandlerResult handle(const std::shared_ptr<BaseEvent> &event) = 0;
+        /**
+         * @brief Get the type index of the event this handler handles.
+         * @return The type index.
+         */
+        virtual std::type_index getEventType() const = 0;
+    };
+
+    // Event handler receiving typed event data
+    template <typename T>
+    class TypedEventHandler : public BaseEventHandler {
+    public:
+        /**
+         * @brief Handle the event data.
+         * @param event The event carrying the data.
+         * @param eventData The event data, possibly a base subobject of the event's payload.
+         * @return The result of the invocation.
+         */
+        virtual HandlerResult handleData(const std::shared_ptr<BaseEvent> &event, const T &eventData) = 0;
+
+        HandlerResult handle(const std::shared_ptr<BaseEvent> &event) override {
+            return handleData(event, *static_cast<const T *>(event->payload()));
+        }
+
+        /**
+         * @brief Get the type index of the event this handler handles.
+         * @return The type index.
+         */
+        std::type_index getEventType() const override {
+            return std::type_index(typeid(T));
+        }
+    };
+
+    // Typed event handler with a minimum priority, filters and an optional invocation budget
+    template <typename T>
+    class FilteredEventHandler : public TypedEventHandler<T> {
+    private:
+        std::vector<std::unique_ptr<EventFilter<T>>> filters;
+        neko::Priority minPriority = neko::Priority::Low;
+
+    public:
+        /**
+         * @brief Check the event against the minimum priority without reading its payload.
+         * @return True if the event's priority meets the minimum priority.
+         */
+        bool admitsPriority(const BaseEvent &event) const {
+            return static_cast<neko::uint8>(event.priority) >= static_cast<neko::uint8>(minPriority);
+        }
+
+    protected:
+        /**
+         * @brief Check the event against the minimum priority and the filters, then claim an invocation.
+         * @return True if the handler should be invoked.
+         * @note Filtered events do not use up the invocations of a limited handler.
+         */
+        bool accepts(const std::shared_ptr<BaseEvent> &event, const T &eventData) {
+            // Check priority
+            if (!admitsPriority(*event)) {
+                return false;
+            }
+
+            // Apply filters
+            for (const auto &filter : filters) {
+                if (!filter->shouldProcess(eventData)) {
+                    return false;
+                }
+            }
+
+            return this->takeShot();
+        }
+
+    public:
+        /**
+         * @brief Add a filter to this handler.
+         * @param filter The filter to add.
+         */
+        void addFilter(std::unique_ptr<EventFilter<T>> filter) {
+            filters.push_back(std::move(filter));
+        }
+
+        /**
+         * @brief Set the minimum priority for this handler.
+         * @param priority The minimum priority.
+         */
+        void setMinPriority(neko::Priority priority) {
+            minPriority = priority;
+        }
+    };
+
+    // Enhanced event handler with filters
+    template <typename T>
+    class EventHandler final : public FilteredEventHandler<T> {
+    public:
+        using Callback = std::function<HandlerResult(const std::shared_ptr<BaseEvent> &, const T &)>;
+
+    private:
+        Callback callback;
+
+        template <typename F>
+        static Callback makeCallback(F &&cb) {
+            if constexpr (std::is_invocable_v<F &, const T &>) {
+                return [cb = std::forward<F>(cb)](const std::shared_ptr<BaseEvent> &, const T &eventData) mutable -> HandlerResult {
+                    if constexpr (std::is_same_v<std::invoke_result_t<F &, const T &>, HandlerResult>) {
+                        return cb(eventData);
+                    } else {
+                        cb(eventData);
+                        return HandlerResult::ok();
+                    }
+                };
+            } else {
+                // Share ownership of the payload with the event instead of copying it
+                return [cb = std::forward<F>(cb)](const std::shared_ptr<BaseEvent> &event, const T &eventData) mutable -> HandlerResult {
+                    std::shared_ptr<const T> shared(event, &eventData);
+                    if constexpr (std::is_same_v<std::invoke_result_t<F &, std::shared_ptr<const T>>, HandlerResult>) {
+                        return cb(std::move(shared));
+                    } else {
+                        cb(std::move(shared));
+                        return HandlerResult::ok();
+                    }
+                };
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct an EventHandler with a callback.
+         * @param cb The callback function, taking either `const T &` or `std::shared_ptr<const T>`
+         * and returning either void or HandlerResult.
+         */
+        template <typename F>
+            requires(std::is_invocable_v<F &, const T &> || std::is_invocable_v<F &, std::shared_ptr<const T>>)
+        EventHandler(F &&cb) : callback(makeCallback(std::forward<F>(cb))) {}
+
+        /**
+         * @brief Handle the event data.
+         * @return Filtered if skipped, otherwise the callback's result.
+         * @throws maybe throw exceptions in the callback.
+         * @note The callback will only be invoked if the event's priority meets the minimum required priority
+         */
+        HandlerResult handleData(const std::shared_ptr<BaseEvent> &event, const T &eventData) override {
+            if (!this->accepts(event, eventData)) {
+                return HandlerResult::filtered();
+            }
+            return callback(event, eventData);
+        }
+
+        HandlerResult handle(const std::shared_ptr<BaseEvent> &event) override {
+            // Checked before reading the payload so lazy payloads are not built for skipped handlers
+            if (!this->admitsPriority(*event)) {
+                return HandlerResult::filtered();
+            }
+            return EventHandler::handleData(event, *static_cast<const T *>(event->payload()));
+        }
+    };
+
+    // Event handler calling a member function of an owner it does not keep alive
+    template <typename T, typename Owner, typename Method>
+        requires std::is_invocable_v<Method, Owner &, const T &>
+    class MemberEventHandler final : public FilteredEventHandler<T> {
+    private:
+        std::weak_ptr<Owner> owner;
+        Method method;
+
+    public:
+        /**
+         * @brief Construct a MemberEventHandler.
+         * @param eventOwner The object whose member function handles the events.
+         * @param memberFunction The member function, taking `const T &` and returning either void or HandlerResult.
+         */
+        MemberEventHandler(std::weak_ptr<Owner> eventOwner, Method memberFunction)
+            : owner(std::move(eventOwner)), method(memberFunction) {}
+
+        /**
+         * @brief Handle the event data if the owner is still alive.
+         * @return Filtered if skipped or the owner is gone, otherwise the member function's result.
+         * @throws maybe throw exceptions in the member function.
+         * @details Deactivates the handler once the owner has expired, the loop then removes it.
+         */
+        HandlerResult handleData(const std::shared_ptr<BaseEvent> &event, const T &eventData) override {
+            auto target = owner.lock();
+            if (!target) {
+                this->deactivate();
+                return HandlerResult::filtered();
+            }
+            if (!this->accepts(event, eventData)) {
+                return HandlerResult::filtered();
+            }
+
+            if constexpr (std::is_same_v<std::invoke_result_t<Method, Owner &, const T &>, HandlerResult>) {
+                return ((*target).*method)(eventData);
+            } else {
+                ((*target).*method)(eventData);
+                return HandlerResult::ok();
+            }
+        }
+
+        HandlerResult handle(const std::shared_ptr<BaseEvent> &event) override {
+            if (!this->admitsPriority(*event)) {
+                return HandlerResult::filtered();
+            }
+            return MemberEventHandler::handleData(event, *static_cast<const T *>(event->payload()));
+        }
+    };
+
+    namespace detail {
+        struct BatchBufferBase {
+            virtual ~BatchBufferBase() = default;
+            /**
+             * @brief Clear the buffer and keep it for the next batch of the calling thread.
+             * @param self Owns this buffer.
+             */
+            virtual void recycle(std::unique_ptr<BatchBufferBase> self) = 0;
+        };
+
+        // Contiguous payloads of one batch, reused by the thread across batches of type T
+        template <typename T>
+        struct BatchBuffer final : BatchBufferBase {
+            std::vector<T> items;
+
+            static std::unique_ptr<BatchBuffer> &cached() {
+                thread_local std::unique_ptr<BatchBuffer> buffer;
+                return buffer;
+            }
+
+            // Taken out of the cache while in use, so nested batches get their own buffer
+            static std::unique_ptr<BatchBuffer> acquire() {
+                auto &buffer = cached();
+                return buffer ? std::move(buffer) : std::make_unique<BatchBuffer>();
+            }
+
+            void recycle(std::unique_ptr<BatchBufferBase> self) override {
+                items.clear();
+                cached().reset(static_cast<BatchBuffer *>(self.release()));
+            }
+        };
+    } // namespace detail
+
+    /**
+     * @class EventBatch
+     * @brief A run of consecutive events of one type, dispatched to the batch handlers of that type.
+     * @details The payloads are copied into contiguous storage once, by the first handler asking
+     * for them, and shared by all batch handlers of the batch.
+     */
+    class EventBatch {
+    private:
+        std::span<const std::shared_ptr<BaseEvent>> batchEvents;
+        std::unique_ptr<detail::BatchBufferBase> buffer;
+
+    public:
+        explicit EventBatch(std::span<const std::shared_ptr<BaseEvent>> events) : batchEvents(events) {}
+        EventBatch(const EventBatch &) = delete;
+        EventBatch &operator=(const EventBatch &) = delete;
+
+        ~EventBatch() {
+            if (buffer) {
+                auto *owner = buffer.get();
+                owner->recycle(std::move(buffer));
+            }
+        }
+
+        /**
+         * @brief Get the events of the batch.
+         * @return The events, all of the same type.
+         */
+        std::span<const std::shared_ptr<BaseEvent>> events() const {
+            return batchEvents;
+        }
+
+        /**
+         * @brief Get the payloads of the batch as contiguous data.
+         * @tparam T The event data type, which must be the type of the events.
+         * @return The payloads, in event order.
+         */
+        template <typename T>
+        std::span<const T> items() {
+            if (!buffer) {
+                auto typed = detail::BatchBuffer<T>::acquire();
+                typed->items.reserve(batchEvents.size());
+                for (const auto &event : batchEvents) {
+                    typed->items.push_back(*static_cast<const T *>(event->payload()));
+                }
+                buffer = std::move(typed);
+            }
+            return static_cast<const detail::BatchBuffer<T> &>(*buffer).items;
+        }
+    };
+
+    // Batch event handler interface
+    class BaseBatchHandler {
+    public:
+        HandlerId id;
+        std::atomic<bool> active{true}; // Cleared on unsubscribe, dispatch skips inactive handlers
+        virtual ~BaseBatchHandler() = default;
+        /**
+         * @brief Handle a run of consecutive events of the same type.
+         * @param batch The events to handle.
+         * @return The result of the invocation.
+         */
+        virtual HandlerResult handleBatch(EventBatch &batch) = 0;
+    };
+
+    // Batch event handler receiving contiguous event data
+    template <typename T>
+    class BatchEventHandler final : public BaseBatchHandler {
+    public:
+        using Callback = std::function<HandlerResult(std::span<const T>)>;
+
+    private:
+        Callback callback;
+        std::vector<std::unique_ptr<EventFilter<T>>> filters;
+        std::vector<std::unique_ptr<BatchFilter<T>>> batchFilters;
+        neko::Priority minPriority = neko::Priority::Low;
+
+        template <typename F>
+        static Callback makeCallback(F &&cb) {
+            if constexpr (std::is_same_v<std::invoke_result_t<F &, std::span<const T>>, HandlerResult>) {
+                return Callback(std::forward<F>(cb));
+            } else {
+                return [cb = std::forward<F>(cb)](std::span<const T> items) mutable -> HandlerResult {
+                    cb(items);
+                    return HandlerResult::ok();
+                };
+            }
+        }
+
+    public:
+        /**
+         * @brief Construct a BatchEventHandler with a callback.
+         * @param cb The callback function, returning either void or HandlerResult.
+         */
+        template <typename F>
+            requires std::is_invocable_v<F &, std::span<const T>>
+        BatchEventHandler(F &&cb) : callback(makeCallback(std::forward<F>(cb))) {}
+
+        /**
+         * @brief Add a filter to this handler.
+         * @param filter The filter to add.
+         * @note BatchFilter instances are evaluated in bulk over the whole batch.
+         */
+        void addFilter(std::unique_ptr<EventFilter<T>> filter) {
+            if (auto *batchFilter = dynamic_cast<BatchFilter<T> *>(filter.get())) {
+                filter.release();
+                batchFilters.emplace_back(batchFilter);
+            } else {
+                filters.push_back(std::move(filter));
+            }
+        }
+
+        /**
+         * @brief Set the minimum priority for this handler.
+         * @param priority The minimum priority.
+         */
+        void setMinPriority(neko::Priority priority) {
+            minPriority = priority;
+        }
+
+        /**
+         * @brief Select the accepted event data of the batch and invoke the callback once.
+         * @return Filtered if no event was accepted, otherwise the callback's result.
+         * @throws maybe throw exceptions in the callback.
+         * @details Receives the batch's shared payload buffer directly when every event is accepted,
+         * otherwise a copy of the accepted items in a reused thread-local buffer.
+         */
+        HandlerResult handleBatch(EventBatch &batch) override {
+            auto events = batch.events();
+            auto items = batch.items<T>();
+
+            // Build the selection mask before the handler runs
+            detail::ScratchVector<std::vector<neko::uint8>> mask;
+            mask.vector.resize(items.size());
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < items.size(); ++i) {
+                bool accepted = static_cast<neko::uint8>(events[i]->priority) >= static_cast<neko::uint8>(minPriority) &&
+                                std::all_of(filters.begin(), filters.end(), [&items, i](const auto &filter) {
+                                    return filter->shouldProcess(items[i]);
+                                });
+                mask.vector[i] = accepted;
+                kept += accepted;
+            }
+
+            if (!batchFilters.empty() && kept > 0) {
+                detail::ScratchVector<std::vector<neko::uint8>> selected;
+                selected.vector.resize(items.size());
+                for (const auto &batchFilter : batchFilters) {
+                    batchFilter->evaluate(items, selected.vector.data());
+                    for (std::size_t i = 0; i < items.size(); ++i) {
+                        mask.vector[i] &= selected.vector[i];
+                    }
+                }
+                kept = static_cast<std::size_t>(std::count(mask.vector.begin(), mask.vector.end(), neko::uint8(1)));
+            }
+
+            if (kept == 0) {
+                return HandlerResult::filtered();
+            }
+            if (kept == items.size()) {
+                return callback(items);
+            }
+
+            detail::ScratchVector<std::vector<T>> accepted;
+            accepted.vector.reserve(kept);
+            for (std::size_t i = 0; i < items.size(); ++i) {
+                if (mask.vector[i]) {
+                    accepted.vector.push_back(items[i]);
+                }
+            }
+            return callback(std::span<const T>(accepted.vector));
+        }
+    };
+
+    using BatchHandlerList = std::vector<std::shared_ptr<BaseBatchHandler>>;
+
+    // Read-only view of buffered rows of a columnar event type, one span per field
+    template <ColumnarType T>
+    class ColumnView {
+    private:
+        using Spans = typename detail::ColumnTypes<detail::ColumnFields<T>>::Spans;
+
+        Spans columns;
+        std::size_t rows = 0;
+
+        template <std::size_t... I>
+        T rowAt(std::size_t index, std::index_sequence<I...>) const {
+            T row{};
+            ((row.*std::get<I>(ColumnLayout<T>::fields) = std::get<I>(columns)[index]), ...);
+            return row;
+        }
+
+    public:
+        /**
+         * @brief Construct a view over column arrays.
+         * @param vectors The column arrays, all of the same length.
+         */
+        explicit ColumnView(const detail::ColumnVectors<T> &vectors)
+            : columns(std::apply([](const auto &...column) { return Spans(column...); }, vectors)),
+              rows(std::get<0>(vectors).size()) {}
+
+        std::size_t size() const {
+            return rows;
+        }
+
+        bool empty() const {
+            return rows == 0;
+        }
+
+        /**
+         * @brief Get a column by its position in the layout.
+         * @tparam I The field position.
+         * @return The contiguous field values.
+         */
+        template <std::size_t I>
+        auto column() const {
+            return std::get<I>(columns);
+        }
+
+        /**
+         * @brief Get a column by field.
+         * @tparam Member The field, e.g. &Tick::price.
+         * @return The contiguous field values.
+         */
+        template <auto Member>
+            requires std::is_member_object_pointer_v<decltype(Member)>
+        auto column() const {
+            return std::get<detail::columnIndex<T, Member>()>(columns);
+        }
+
+        /**
+         * @brief Reassemble a row into an object.
+         * @param index The row index.
+         * @return The row, fields outside the layout are value-initialized.
+         */
+        T row(std::size_t index) const {
+            return rowAt(index, std::make_index_sequence<std::tuple_size_v<Spans>>{});
+        }
+    };
+
+    // Handler receiving columnar rows of one event type
+    template <ColumnarType T>
+    class ColumnEventHandler {
+    public:
+        using Callback = std::function<HandlerResult(const ColumnView<T> &)>;
+
+        HandlerId id = 0;
+        std::atomic<bool> active{true}; // Cleared on unsubscribe, dispatch skips inactive handlers
+
+        /**
+         * @brief Construct a ColumnEventHandler with a callback.
+         * @param cb The callback function, returning either void or HandlerResult.
+         */
+        template <typename F>
+            requires std::is_invocable_v<F &, const ColumnView<T> &>
+        ColumnEventHandler(F &&cb) {
+            if constexpr (std::is_same_v<std::invoke_result_t<F &, const ColumnView<T> &>, HandlerResult>) {
+                callback = Callback(std::forward<F>(cb));
+            } else {
+                callback = [cb = std::forward<F>(cb)](const ColumnView<T> &view) mutable -> HandlerResult {
+                    cb(view);
+                    return HandlerResult::ok();
+                };
+            }
+        }
+
+        /**
+         * @brief Handle a set of rows.
+         * @param view The rows.
+         * @return The result of the invocation.
+         * @throws maybe throw exceptions in the callback.
+         */
+        HandlerResult handleColumns(const ColumnView<T> &view) {
+            return callback(view);
+        }
+
+    private:
+        Callback callback;
+    };
+
+    template <ColumnarType T>
+    using ColumnHandlerList = std::vector<std::shared_ptr<ColumnEventHandler<T>>>;
+
+    // Reason an event was moved to the dead-letter queue
+    enum class DeadLetterReason : neko::uint8 {
+        Overflow,   // Dropped because the event queue was full
+        Exception,  // A handler threw an exception
+        Failed,     // A handler returned a failed HandlerResult
+        Expired,    // Discarded before it could be dispatched
+        Filtered,   // No handler accepted the event
+        Cascade,    // Published beyond the maximum cascade depth
+        RateLimited // Rejected by the rate limit of its type
+    };
+
+    // Dead-letter queue entry
+    struct DeadLetter {
+        std::shared_ptr<BaseEvent> event;
+        DeadLetterReason reason;
+        HandlerId handlerId = 0; // The first failing handler, 0 if not handler related
+        std::string message;
+        TimePoint time{};
+        neko::uint32 attempts = 0; // Number of retries already made for the event
+    };
+
+    // Time source of the task scheduler
+    class Clock {
+    public:
+        virtual ~Clock() = default;
+        /**
+         * @brief Get the current time.
+         * @return The current time, never decreasing.
+         */
+        virtual TimePoint now() const = 0;
+    };
+
+    // Clock following std::chrono::steady_clock, the default
+    class SteadyClock final : public Clock {
+    public:
+        TimePoint now() const override {
+            return std::chrono::steady_clock::now();
+        }
+    };
+
+    // Clock that only moves when advanced, for deterministic simulation and tests
+    class ManualClock final : public Clock {
+    private:
+        std::atomic<TimePoint::rep> ticks;
+
+    public:
+        /**
+         * @brief Construct a manual clock.
+         * @param start The initial time.
+         */
+        explicit ManualClock(TimePoint start = TimePoint{}) : ticks(start.time_since_epoch().count()) {}
+
+        TimePoint now() const override {
+            return TimePoint(TimePoint::duration(ticks.load(std::memory_order_acquire)));
+        }
+
+        /**
+         * @brief Move the clock forward.
+         * @param duration The time to add.
+         */
+        void advance(TimePoint::duration duration) {
+            ticks.fetch_add(duration.count(), std::memory_order_acq_rel);
+        }
+    };
+
+    // scheduled task
+    struct ScheduledTask {
+        TimePoint execTime;
+        std::function<void()> callback;
+        EventId id;
+        neko::Priority priority;
         bool cancelled = false;
         bool repeating = false;
         std::chrono::milliseconds interval{0};
 
         /**
-         * @brief Construct a scheduled task.
-         * @param t The execution time.
-         * @param cb The callback function.
-         * @param eventId The event/task ID.
-         * @param prio The priority.
+         * @brief Construct a scheduled task.
+         * @param t The execution time.
+         * @param cb The callback function.
+         * @param eventId The event/task ID.
+         * @param prio The priority.
+         */
+        ScheduledTask(TimePoint t, std::function<void()> cb, EventId eventId, neko::Priority prio = neko::Priority::Normal)
+            : execTime(t), callback(std::move(cb)), id(eventId), priority(prio) {}
+
+        /**
+         * @brief Compare two scheduled tasks for priority.
+         * @note  execTime > priority > id
+         */
+        bool operator<(const ScheduledTask &other) const {
+            if (execTime != other.execTime) {
+                return execTime > other.execTime;
+            }
+            if (static_cast<neko::uint8>(priority) != static_cast<neko::uint8>(other.priority)) {
+                return static_cast<neko::uint8>(priority) < static_cast<neko::uint8>(other.priority);
+            }
+            return id > other.id;
+        }
+        bool operator>(const ScheduledTask &other) const {
+            return other < *this;
+        }
+    };
+
+    using HandlerList = std::vector<std::shared_ptr<BaseEventHandler>>;
+
+    namespace detail {
+        /**
+         * @class ReclaimDomain
+         * @brief Epoch-based deferred reclamation for data read without locks and replaced copy-on-write.
+         * @details Readers wrap their accesses in a Guard, which registers them in the current epoch.
+         * Writers unlink the old object first, then retire() it tagged with the current epoch. The epoch
+         * advances once no reader is left in the previous one, and an object is destroyed two epochs
+         * after it was retired, when no reader that could have seen it remains. A reader staying inside
+         * its guard only delays objects retired since the epoch it entered in.
+         */
+        class ReclaimDomain {
+        private:
+            std::atomic<neko::uint64> epoch{2};
+            std::atomic<neko::uint64> readers[2] = {0, 0}; // Readers by epoch parity
+            std::atomic<neko::uint64> retiredCount{0};
+            std::mutex retiredMtx;
+            std::vector<std::pair<neko::uint64, std::shared_ptr<const void>>> retired; // Tagged with the epoch of retirement
+
+        public:
+            class Guard {
+            private:
+                ReclaimDomain &domain;
+                std::atomic<neko::uint64> *counter;
+
+            public:
+                explicit Guard(ReclaimDomain &reclaimDomain) : domain(reclaimDomain) {
+                    for (;;) {
+                        auto current = domain.epoch.load();
+                        counter = &domain.readers[current & 1];
+                        counter->fetch_add(1);
+                        // Registered in a stale epoch if it advanced meanwhile, retry in the new one
+                        if (domain.epoch.load() == current)
+                            break;
+                        counter->fetch_sub(1);
+                    }
+                }
+                ~Guard() {
+                    if (counter->fetch_sub(1) == 1) {
+                        domain.reclaim();
+                    }
+                }
+                Guard(const Guard &) = delete;
+                Guard &operator=(const Guard &) = delete;
+            };
+
+            /**
+             * @brief Retire an object that is no longer reachable by new readers.
+             * @param object The object, destroyed once all readers that could have seen it have left.
+             */
+            void retire(std::shared_ptr<const void> object) {
+                if (!object)
+                    return;
+                std::lock_guard<std::mutex> lock(retiredMtx);
+                retired.emplace_back(epoch.load(), std::move(object));
+                retiredCount.store(retired.size(), std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Advance the epoch if possible and destroy the retired objects that became unreachable.
+             * @details Safe to call from inside a guard, objects the caller may still see are kept.
+             */
+            void reclaim() {
+                if (retiredCount.load(std::memory_order_relaxed) == 0)
+                    return;
+
+                std::vector<std::shared_ptr<const void>> garbage;
+                {
+                    std::unique_lock<std::mutex> lock(retiredMtx, std::try_to_lock);
+                    if (!lock.owns_lock())
+                        return;
+
+                    // Two steps suffice to release everything when no reader is active
+                    auto current = epoch.load();
+                    for (int step = 0; step < 2 && readers[(current - 1) & 1].load() == 0; ++step) {
+                        epoch.store(++current);
+                    }
+
+                    auto reclaimable = std::stable_partition(retired.begin(), retired.end(), [current](const auto &entry) {
+                        return entry.first + 2 > current;
+                    });
+                    for (auto it = reclaimable; it != retired.end(); ++it) {
+                        garbage.push_back(std::move(it->second));
+                    }
+                    retired.erase(reclaimable, retired.end());
+                    retiredCount.store(retired.size(), std::memory_order_relaxed);
+                }
+                // Destroyed outside the lock, destructors may retire more objects
+            }
+        };
+
+        // Creates the handler that delivers derived events to a handler of a base type
+        using UpcastFactory = std::shared_ptr<BaseEventHandler> (*)(const std::shared_ptr<BaseEventHandler> &);
+
+        // Delivers events of a derived payload type to a handler subscribed to a base type
+        template <typename Derived, typename Base>
+        class UpcastEventHandler final : public BaseEventHandler {
+        private:
+            std::shared_ptr<FilteredEventHandler<Base>> inner;
+
+        public:
+            explicit UpcastEventHandler(std::shared_ptr<FilteredEventHandler<Base>> handler) : inner(std::move(handler)) {
+                id = inner->id;
+                priority = inner->priority;
+                activeSource = inner.get();
+            }
+
+            HandlerResult handle(const std::shared_ptr<BaseEvent> &event) override {
+                // Checked before reading the payload so lazy payloads are not built for skipped handlers
+                if (!inner->admitsPriority(*event)) {
+                    return HandlerResult::filtered();
+                }
+                const auto &derived = *static_cast<const Derived *>(event->payload());
+                return inner->handleData(event, static_cast<const Base &>(derived));
+            }
+
+            std::type_index getEventType() const override {
+                return std::type_index(typeid(Derived));
+            }
+        };
+
+        template <typename Derived, typename Base>
+        std::shared_ptr<BaseEventHandler> makeUpcastHandler(const std::shared_ptr<BaseEventHandler> &handler) {
+            return std::make_shared<UpcastEventHandler<Derived, Base>>(std::static_pointer_cast<FilteredEventHandler<Base>>(handler));
+        }
+
+        template <typename T>
+        constexpr bool hasEventBases = !std::is_same_v<typename EventBases<T>::type, BaseTypes<>>;
+
+        // Rows of a columnar event type waiting for dispatch
+        class ColumnStoreBase {
+        public:
+            virtual ~ColumnStoreBase() = default;
+            /**
+             * @brief Drop all buffered rows.
+             * @return The number of dropped rows.
+             */
+            virtual neko::uint64 discard() = 0;
+            /**
+             * @brief Drop unsubscribed column handlers from the handler list.
+             * @param domain Retires the previous list.
+             * @note The caller must hold the registry lock exclusively.
+             */
+            virtual void compactHandlers(ReclaimDomain &domain) = 0;
+            /**
+             * @brief Get the number of column handlers, unsubscribed ones included.
+             * @note The caller must hold the registry lock.
+             */
+            virtual std::size_t handlerCount() const = 0;
+
+            std::size_t deadHandlers = 0; // Unsubscribed handlers still in the list, guarded by the registry lock
+        };
+
+        template <ColumnarType T>
+        class ColumnStore final : public ColumnStoreBase {
+        private:
+            std::mutex mtx;
+            ColumnVectors<T> active;
+            ColumnVectors<T> spare; // Arrays of the previous flush, kept to reuse their capacity
+            bool flushPending = false;
+
+        public:
+            // Result of appending a row
+            enum class Append : neko::uint8 {
+                Buffered,   // Added behind a pending flush
+                NeedsFlush, // Added, the caller must enqueue a flush
+                Full        // Rejected, the store is at capacity
+            };
+
+            neko::uint64 capacity;
+
+            // Column handlers, guarded by the registry lock and replaced copy-on-write
+            std::atomic<const ColumnHandlerList<T> *> handlers{nullptr};
+            std::shared_ptr<const ColumnHandlerList<T>> owner;
+
+            explicit ColumnStore(neko::uint64 maxRows) : capacity(maxRows) {}
+
+            Append append(const T &row) {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (std::get<0>(active).size() >= capacity)
+                    return Append::Full;
+
+                appendRow(active, row);
+                if (flushPending)
+                    return Append::Buffered;
+                flushPending = true;
+                return Append::NeedsFlush;
+            }
+
+            /**
+             * @brief Take the buffered rows, ending the pending flush.
+             * @return The column arrays.
+             */
+            ColumnVectors<T> take() {
+                std::lock_guard<std::mutex> lock(mtx);
+                ColumnVectors<T> taken = std::move(active);
+                active = std::move(spare);
+                flushPending = false;
+                return taken;
+            }
+
+            /**
+             * @brief Give back column arrays taken earlier so their capacity is reused.
+             * @param columns The column arrays.
+             */
+            void recycle(ColumnVectors<T> &&columns) {
+                std::apply([](auto &...column) { (column.clear(), ...); }, columns);
+                std::lock_guard<std::mutex> lock(mtx);
+                spare = std::move(columns);
+            }
+
+            neko::uint64 discard() override {
+                std::lock_guard<std::mutex> lock(mtx);
+                neko::uint64 rows = std::get<0>(active).size();
+                std::apply([](auto &...column) { (column.clear(), ...); }, active);
+                flushPending = false;
+                return rows;
+            }
+
+            void compactHandlers(ReclaimDomain &domain) override {
+                std::shared_ptr<ColumnHandlerList<T>> compacted;
+                if (owner) {
+                    compacted = std::make_shared<ColumnHandlerList<T>>();
+                    std::copy_if(owner->begin(), owner->end(), std::back_inserter(*compacted),
+                                 [](const std::shared_ptr<ColumnEventHandler<T>> &handler) {
+                                     return handler->active.load();
+                                 });
+                    if (compacted->empty()) {
+                        compacted.reset();
+                    }
+                }
+                handlers.store(compacted.get());
+                domain.retire(std::move(owner));
+                owner = std::move(compacted);
+                deadHandlers = 0;
+            }
+
+            std::size_t handlerCount() const override {
+                return owner ? owner->size() : 0;
+            }
+        };
+
+        // Handlers of one event type, replaced copy-on-write
+        struct HandlerSlot {
+            std::atomic<const HandlerList *> handlers{nullptr}; // Current snapshot, read without locks
+            std::shared_ptr<const HandlerList> owner;           // Owns the snapshot, guarded by the registry lock
+
+            std::atomic<bool> stale{false};                     // Handlers changed since the snapshot was built
+            std::atomic<std::size_t> activeHandlers{0};         // Active per-event handlers of this exact type
+            std::atomic<std::size_t> activeBulkHandlers{0};     // Active batch and column handlers
+
+            // The fields below are guarded by the registry lock
+            HandlerList own;                                              // Handlers subscribed to this exact type, null where freed
+            std::vector<std::size_t> freeHandlers;                        // Free positions in own, reused before growing it
+            std::atomic<const BatchHandlerList *> batchHandlers{nullptr}; // Batch handlers, replaced copy-on-write
+            std::shared_ptr<const BatchHandlerList> batchOwner;
+            std::vector<std::pair<std::size_t, UpcastFactory>> bases;     // Ancestor types, transitively
+            std::vector<std::size_t> derived;                             // Descendant types, transitively
+            std::atomic<ColumnStoreBase *> columns{nullptr};              // Columnar buffer, set once by enableColumnar()
+            std::unique_ptr<ColumnStoreBase> columnOwner;
+            std::size_t deadHandlers = 0;                                 // Unsubscribed handlers still in the snapshot
+            std::size_t deadBatchHandlers = 0;                            // Unsubscribed handlers still in the batch list
+            std::atomic<RateLimiter *> rateLimiter{nullptr};              // Publish rate limit, set once by setRateLimit()
+            std::unique_ptr<RateLimiter> rateLimiterOwner;
+        };
+
+        // Handler slots by type ordinal, readable without locks whether or not the registry is frozen
+        class SlotDirectory {
+        private:
+            struct Table {
+                std::size_t size;
+                std::unique_ptr<std::atomic<HandlerSlot *>[]> slots;
+            };
+
+            std::atomic<const Table *> current{nullptr};
+            std::vector<std::unique_ptr<Table>> tables; // Outgrown tables stay alive so readers never need a guard
+
+        public:
+            /**
+             * @brief Find the slot of a type.
+             * @param ordinal The type ordinal.
+             * @return The slot, or nullptr if the type is not registered.
+             */
+            HandlerSlot *find(std::size_t ordinal) const {
+                const Table *table = current.load(std::memory_order_acquire);
+                if (!table || ordinal >= table->size)
+                    return nullptr;
+                return table->slots[ordinal].load(std::memory_order_acquire);
+            }
+
+            /**
+             * @brief Add the slot of a newly registered type.
+             * @param ordinal The type ordinal.
+             * @param slot The slot, which must outlive the directory.
+             * @note The caller must hold the registry lock exclusively.
+             */
+            void insert(std::size_t ordinal, HandlerSlot *slot) {
+                const Table *table = current.load(std::memory_order_relaxed);
+                if (!table || ordinal >= table->size) {
+                    // Doubling keeps the outgrown tables below the size of the current one
+                    auto grown = std::make_unique<Table>();
+                    grown->size = std::max<std::size_t>({ordinal + 1, table ? table->size * 2 : 0, 16});
+                    grown->slots = std::make_unique<std::atomic<HandlerSlot *>[]>(grown->size);
+                    for (std::size_t i = 0; table && i < table->size; ++i) {
+                        grown->slots[i].store(table->slots[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    }
+                    table = grown.get();
+                    tables.push_back(std::move(grown));
+                    current.store(table, std::memory_order_release);
+                }
+                table->slots[ordinal].store(slot, std::memory_order_release);
+            }
+        };
+
+        // Kind of handler list a handler ID belongs to
+        enum class HandlerKind : neko::uint8 {
+            Event,
+            Batch,
+            Column
+        };
+
+        // Location of a subscribed handler, for unsubscribing by ID alone
+        struct HandlerRecord {
+            std::size_t typeOrdinal;
+            HandlerKind kind;
+            std::atomic<bool> *active; // Flag of the handler, which stays in its list until compacted
+            std::size_t position = 0;  // Position in the slot's own handlers, for per-event handlers
+        };
+
+        /**
+         * @brief Invoke a callback returning either void or HandlerResult.
+         * @return The callback's result, ok() for void callbacks.
+         */
+        template <typename Callback, typename... Args>
+        HandlerResult invokeCallback(Callback &callback, Args &&...args) {
+            if constexpr (std::is_same_v<std::invoke_result_t<Callback &, Args...>, HandlerResult>) {
+                return callback(std::forward<Args>(args)...);
+            } else {
+                callback(std::forward<Args>(args)...);
+                return HandlerResult::ok();
+            }
+        }
+
+        /**
+         * @class EventRing
+         * @brief Ring buffer of values with their arrival times, for the stream operators.
+         * @details Grows by doubling when full and reuses its slots afterwards, so steady-state
+         * pushes do not allocate.
+         */
+        template <typename T>
+        class EventRing {
+        public:
+            struct Entry {
+                TimePoint time;
+                T value;
+            };
+
+        private:
+            std::vector<std::optional<Entry>> slots;
+            std::size_t head = 0;
+            std::size_t count = 0;
+
+            void grow() {
+                std::vector<std::optional<Entry>> larger(std::max<std::size_t>(8, slots.size() * 2));
+                for (std::size_t i = 0; i < count; ++i) {
+                    larger[i] = std::move(slots[(head + i) % slots.size()]);
+                }
+                slots.swap(larger);
+                head = 0;
+            }
+
+        public:
+            std::size_t size() const {
+                return count;
+            }
+
+            bool empty() const {
+                return count == 0;
+            }
+
+            /**
+             * @brief Append a value.
+             * @param time The arrival time, not earlier than the newest value's.
+             * @param value The value.
+             */
+            void push(TimePoint time, const T &value) {
+                if (count == slots.size()) {
+                    grow();
+                }
+                auto &slot = slots[(head + count) % slots.size()];
+                if (slot) {
+                    // Assign into the old value to reuse its storage
+                    slot->time = time;
+                    slot->value = value;
+                } else {
+                    slot.emplace(Entry{time, value});
+                }
+                ++count;
+            }
+
+            /**
+             * @brief Drop the values that arrived before a point in time.
+             * @param time The point in time.
+             */
+            void dropBefore(TimePoint time) {
+                while (count > 0 && slots[head]->time < time) {
+                    head = (head + 1) % slots.size();
+                    --count;
+                }
+            }
+
+            /**
+             * @brief Append the values that arrived before a point in time to a vector.
+             * @param out The vector.
+             * @param time The point in time.
+             */
+            void copyBefore(std::vector<T> &out, TimePoint time) const {
+                for (std::size_t i = 0; i < count; ++i) {
+                    const auto &entry = *slots[(head + i) % slots.size()];
+                    if (entry.time >= time)
+                        break;
+                    out.push_back(entry.value);
+                }
+            }
+        };
+
+        /**
+         * @class EventQueue
+         * @brief Event queue with one FIFO lane per priority.
+         * @details Every event keeps a sequence number, so the queue can be consumed in publish order
+         * (popFront) or highest priority first (popTop) without reordering the other events.
+         * Not synchronized, guarded by the event loop's eventMtx.
+         */
+        class EventQueue {
+        private:
+            struct Entry {
+                neko::uint64 seq;
+                std::shared_ptr<BaseEvent> event;
+            };
+
+            std::vector<std::deque<Entry>> lanes; // Indexed by priority value, grown on demand
+            neko::uint64 nextSeq = 0;
+            std::size_t count = 0;
+
+            std::deque<Entry> &oldestLane() {
+                std::deque<Entry> *oldest = nullptr;
+                for (auto &lane : lanes) {
+                    if (!lane.empty() && (!oldest || lane.front().seq < oldest->front().seq)) {
+                        oldest = &lane;
+                    }
+                }
+                return *oldest;
+            }
+
+            std::deque<Entry> &highestLane() {
+                auto it = std::find_if(lanes.rbegin(), lanes.rend(), [](const std::deque<Entry> &lane) { return !lane.empty(); });
+                return *it;
+            }
+
+            static std::shared_ptr<BaseEvent> pop(std::deque<Entry> &lane) {
+                auto event = std::move(lane.front().event);
+                lane.pop_front();
+                return event;
+            }
+
+        public:
+            bool empty() const {
+                return count == 0;
+            }
+
+            std::size_t size() const {
+                return count;
+            }
+
+            void pushBack(std::shared_ptr<BaseEvent> event) {
+                auto lane = static_cast<std::size_t>(event->priority);
+                if (lane >= lanes.size()) {
+                    lanes.resize(lane + 1);
+                }
+                lanes[lane].push_back(Entry{nextSeq++, std::move(event)});
+                ++count;
+            }
+
+            /**
+             * @brief Get the oldest event.
+             * @note The queue must not be empty.
+             */
+            const std::shared_ptr<BaseEvent> &front() {
+                return oldestLane().front().event;
+            }
+
+            /**
+             * @brief Remove the oldest event.
+             * @note The queue must not be empty.
+             */
+            std::shared_ptr<BaseEvent> popFront() {
+                --count;
+                return pop(oldestLane());
+            }
+
+            /**
+             * @brief Remove the oldest event of the highest priority.
+             * @note The queue must not be empty.
+             */
+            std::shared_ptr<BaseEvent> popTop() {
+                --count;
+                return pop(highestLane());
+            }
+
+            /**
+             * @brief Remove all events.
+             * @return The events, in publish order.
+             */
+            std::vector<std::shared_ptr<BaseEvent>> takeAll() {
+                std::vector<std::shared_ptr<BaseEvent>> events;
+                events.reserve(count);
+                while (count > 0) {
+                    events.push_back(popFront());
+                }
+                return events;
+            }
+        };
+    } // namespace detail
+
+    class Subscription;
+
+    /**
+     * @class EventLoop
+     * @brief Event loop class that manages event handling and task scheduling.
+     */
+    class EventLoop {
+    private:
+        // === Member variables ===
+
+        // Task scheduling
+        std::shared_ptr<Clock> clock = std::make_shared<SteadyClock>();
+        std::priority_queue<ScheduledTask> taskQueue;
+        mutable std::mutex taskMtx;
+        std::condition_variable taskCv;
+        std::atomic<bool> stop{false};
+        std::atomic<EventId> nextTaskId{1};
+        std::unordered_set<EventId> cancelledTasks;
+
+        // Handler registry
+        std::unordered_map<std::size_t, std::unique_ptr<detail::HandlerSlot>> handlerSlots; // By type ordinal
+        detail::SlotDirectory slotDirectory; // The same slots, for hasSubscribers()
+        std::vector<detail::HandlerSlot *> frozenSlots; // Immutable after freeze(), indexed by type ordinal
+        std::atomic<bool> registryFrozen{false};
+        std::atomic<bool> hasLateSlots{false}; // Types registered after freeze() live only in handlerSlots
+        mutable std::shared_mutex handlerMtx;
+        mutable detail::ReclaimDomain reclaimDomain;
+        std::unordered_map<HandlerId, detail::HandlerRecord> handlerIndex; // Every subscribed handler, by ID
+        std::vector<HandlerId> expiredHandlers; // Handlers that deactivated themselves, removed outside dispatch
+        std::mutex expiredMtx;
+        std::atomic<bool> hasExpiredHandlers{false};
+        std::atomic<bool> hasRateLimits{false}; // Whether any type has a publish rate limit
+        std::shared_ptr<EventLoop *> lifetime = std::make_shared<EventLoop *>(this); // Expires with the loop, observed by Subscription
+
+        // Event system
+        detail::EventQueue eventQueue;
+        neko::uint64 eventQueueBytes = 0;
+        mutable std::shared_mutex eventMtx;
+        std::condition_variable_any eventCv;
+        std::atomic<HandlerId> nextHandlerId{1};
+        std::atomic<neko::uint64> maxBatchSize{256};
+
+        // Enhanced features e.g. statistics, logging
+        std::atomic<bool> enableStats{true};
+        EventStats stats;
+        mutable std::mutex statsMtx;
+        neko::uint64 maxQueueSize = 100000;
+        neko::uint64 maxQueueBytes = 0; // 0 means unlimited
+        OverflowPolicy overflowPolicy = OverflowPolicy::DropNewest;
+        std::function<void(const std::string &)> logger;
+
+        // Dead-letter queue, disabled while the capacity is 0
+        std::deque<DeadLetter> deadLetters;
+        mutable std::mutex deadLetterMtx;
+        std::atomic<neko::uint64> deadLetterCapacity{0};
+        std::atomic<bool> deadLetterFiltered{false};
+
+        // Phase queues, double-buffered so events published while a phase is pumped wait for the next pump
+        struct PhaseQueue {
+            std::vector<std::shared_ptr<BaseEvent>> active;
+            std::vector<std::shared_ptr<BaseEvent>> spare;
+        };
+        std::unordered_map<Phase, PhaseQueue> phaseQueues;
+        mutable std::mutex phaseMtx;
+
+        std::atomic<TimestampSource> timestampSource{TimestampSource::NEKO_EVENT_TIMESTAMP_SOURCE};
+
+        // Cascade control
+        std::atomic<neko::uint32> maxCascadeDepth{0}; // 0 means unlimited
+        std::atomic<bool> cycleDetection{false};
+        mutable std::shared_mutex cascadeMtx;
+        std::unordered_set<neko::uint64> cascadeEdges;                          // Parent and child type ordinals
+        std::unordered_map<std::size_t, std::vector<std::size_t>> cascadeGraph; // Child types by parent type
+
+        // Event loop control
+        mutable std::mutex loopMtx;
+        std::condition_variable loopCv;
+        std::atomic<bool> wakePending{false};     // Set by notifyLoop(), consumed by waitForWork()
+        std::atomic<neko::uint32> idleRunners{0}; // Threads waiting in waitForWork()
+        ShutdownMode shutdownMode = ShutdownMode::Immediate; // Guarded by loopMtx
+        std::optional<TimePoint> shutdownDeadline;           // Guarded by loopMtx
+        bool shutdownPending = false;                        // Stop requested but not finished yet, guarded by loopMtx
+        std::atomic<LoopState> state{LoopState::Created};
+        neko::uint32 activeRunners = 0; // Threads inside run() or runFor(), guarded by loopMtx
+        std::condition_variable drainedCv;
+
+        // Queue entry standing for the rows buffered in a columnar store
+        struct ColumnFlushEvent final : BaseEvent {
+            detail::ColumnStoreBase *store;
+            void (EventLoop::*flush)(detail::ColumnStoreBase &);
+
+            ColumnFlushEvent(detail::ColumnStoreBase *columnStore, void (EventLoop::*flushStore)(detail::ColumnStoreBase &))
+                : store(columnStore), flush(flushStore) {
+                byteSize = sizeof(ColumnFlushEvent);
+                typeOrdinal = detail::typeOrdinal<ColumnFlushEvent>();
+            }
+
+            std::type_index getType() const override {
+                return std::type_index(typeid(ColumnFlushEvent));
+            }
+
+            const void *payload() const override {
+                return store;
+            }
+        };
+
+    private:
+        // === Internal methods ===
+
+        // === Event methods ===
+        /**
+         * @brief Publish an event to the event queue.
+         * @param event The event to publish.
+         */
+        void publishEvent(const std::shared_ptr<BaseEvent> &event) {
+            stamp(*event);
+            if (!admitCascade(event) || !admitRate(event))
+                return;
+            enqueueEvent(event);
+        }
+
+        /**
+         * @brief Add a stamped and admitted event to the event queue, applying the queue limits.
+         * @param event The event.
+         */
+        void enqueueEvent(const std::shared_ptr<BaseEvent> &event) {
+            std::unique_lock<std::shared_mutex> lock(eventMtx);
+
+            // Whether adding an event of the given size would exceed the count or byte limits
+            auto exceedsLimits = [this](neko::uint64 bytes) {
+                return eventQueue.size() >= maxQueueSize ||
+                       (maxQueueBytes != 0 && eventQueueBytes + bytes > maxQueueBytes);
+            };
+
+            bool accepted = true;
+            std::vector<std::shared_ptr<BaseEvent>> dropped;
+            if (exceedsLimits(event->byteSize)) {
+                bool canEvict = overflowPolicy == OverflowPolicy::DropOldest && maxQueueSize > 0 &&
+                                (maxQueueBytes == 0 || event->byteSize <= maxQueueBytes);
+                if (canEvict) {
+                    while (!eventQueue.empty() && exceedsLimits(event->byteSize)) {
+                        dropped.push_back(eventQueue.popFront());
+                        eventQueueBytes -= dropped.back()->byteSize;
+                    }
+                } else {
+                    accepted = false;
+                    dropped.push_back(event);
+                }
+            }
+
+            if (accepted) {
+                eventQueueBytes += event->byteSize;
+                eventQueue.pushBack(event);
+            }
+            lock.unlock();
+
+            for (const auto &droppedEvent : dropped) {
+                if (droppedEvent->typeOrdinal == detail::typeOrdinal<ColumnFlushEvent>()) {
+                    // The rows behind a dropped flush go with it
+                    auto rows = static_cast<ColumnFlushEvent &>(*droppedEvent).store->discard();
+                    if (enableStats.load()) {
+                        std::lock_guard<std::mutex> statsLock(statsMtx);
+                        stats.droppedEvents += rows;
+                    }
+                    if (logger) {
+                        logger("Event queue overflow, dropping columnar rows");
+                    }
+                    continue;
+                }
+                updateStats(false, true); // dropped event
+                pushDeadLetter(droppedEvent, DeadLetterReason::Overflow);
+                if (logger) {
+                    logger("Event queue overflow, dropping event #" + std::to_string(droppedEvent->id));
+                }
+            }
+            if (!accepted)
+                return;
+
+            // notify the event loop
+            eventCv.notify_one();
+            notifyLoop();
+        }
+
+        /**
+         * @brief Process events from the event queue.
+         * @param limit The maximum number of events to process.
+         * @param deadline Stop once this time is reached, checked between events.
+         * @param untilStop Whether to stop when stopLoop() is called, as run() does.
+         * @param deadlineClock The clock the deadline is measured on, null for std::chrono::steady_clock.
+         * @return The number of events processed.
+         */
+        std::size_t processEvents(std::size_t limit = std::numeric_limits<std::size_t>::max(),
+                                  std::optional<TimePoint> deadline = std::nullopt, bool untilStop = true,
+                                  const Clock *deadlineClock = nullptr) {
+            std::size_t processed = 0;
+            std::vector<std::shared_ptr<BaseEvent>> batch;
+
+            while (processed < limit && !(untilStop && stop.load())) {
+                if (deadline && (deadlineClock ? deadlineClock->now() : std::chrono::steady_clock::now()) >= *deadline)
+                    break;
+
+                std::shared_ptr<BaseEvent> event;
+                {
+                    std::unique_lock<std::shared_mutex> lock(eventMtx);
+                    if (eventQueue.empty())
+                        break;
+                    event = eventQueue.popFront();
+                    eventQueueBytes -= event->byteSize;
+                    ++processed;
+                }
+
+                if (event->typeOrdinal == detail::typeOrdinal<ColumnFlushEvent>()) {
+                    dispatchQueued(event);
+                    continue;
+                }
+
+                // Handler snapshots stay alive until the guard is released
+                detail::ReclaimDomain::Guard guard(reclaimDomain);
+                auto *slot = findSlot(event->typeOrdinal);
+                const BatchHandlerList *batchHandlers = slot ? slot->batchHandlers.load() : nullptr;
+                if (!batchHandlers || batchHandlers->empty()) {
+                    dispatchEvent(event, slot);
+                    continue;
+                }
+
+                // Group consecutive events of the same type for batch handlers
+                batch.clear();
+                batch.push_back(std::move(event));
+                {
+                    std::unique_lock<std::shared_mutex> lock(eventMtx);
+                    auto batchLimit = std::min<neko::uint64>(maxBatchSize.load(), limit - processed + 1);
+                    while (batch.size() < batchLimit && !eventQueue.empty() &&
+                           eventQueue.front()->typeOrdinal == batch.front()->typeOrdinal) {
+                        batch.push_back(eventQueue.popFront());
+                        eventQueueBytes -= batch.back()->byteSize;
+                        ++processed;
+                    }
+                }
+
+                for (const auto &batchEvent : batch) {
+                    dispatchEvent(batchEvent, slot);
+                }
+                dispatchBatch(*batchHandlers, batch);
+            }
+
+            purgeExpiredHandlers();
+            return processed;
+        }
+
+        /**
+         * @brief Process queued events in priority order until a deadline.
+         * @param deadline The deadline, checked between events.
+         * @param untilStop Whether to stop when stopLoop() is called.
+         * @return The number of events processed.
+         * @details Pops the highest priority event (in publish order within a priority) one at a time,
+         * so the rest of the queue stays available to other threads. Events published while processing
+         * are taken in the same order. Events are dispatched one by one, batch handlers receive batches of one.
+         */
+        std::size_t processByPriority(TimePoint deadline, bool untilStop) {
+            std::size_t processed = 0;
+            while (!(untilStop && stop.load()) && std::chrono::steady_clock::now() < deadline) {
+                std::shared_ptr<BaseEvent> event;
+                {
+                    std::unique_lock<std::shared_mutex> lock(eventMtx);
+                    if (eventQueue.empty())
+                        break;
+                    event = eventQueue.popTop();
+                    eventQueueBytes -= event->byteSize;
+                }
+                dispatchQueued(event);
+                ++processed;
+            }
+            purgeExpiredHandlers();
+            return processed;
+        }
+
+        /**
+         * @brief Dispatch an event taken from the event queue.
+         * @param event The event.
+         */
+        void dispatchQueued(const std::shared_ptr<BaseEvent> &event) {
+            if (event->typeOrdinal == detail::typeOrdinal<ColumnFlushEvent>()) {
+                auto &flushEvent = static_cast<ColumnFlushEvent &>(*event);
+                (this->*flushEvent.flush)(*flushEvent.store);
+                return;
+            }
+            dispatchEvents(std::span<const std::shared_ptr<BaseEvent>>(&event, 1));
+        }
+
+        /**
+         * @brief Dispatch already published events, grouping consecutive events of one type for batch handlers.
+         * @param events The events.
+         */
+        void dispatchEvents(std::span<const std::shared_ptr<BaseEvent>> events) {
+            // Handler snapshots stay alive until the guard is released
+            detail::ReclaimDomain::Guard guard(reclaimDomain);
+            std::size_t begin = 0;
+            while (begin < events.size()) {
+                auto *slot = findSlot(events[begin]->typeOrdinal);
+                const BatchHandlerList *batchHandlers = slot ? slot->batchHandlers.load() : nullptr;
+
+                std::size_t end = begin + 1;
+                if (batchHandlers) {
+                    auto batchLimit = maxBatchSize.load();
+                    while (end < events.size() && end - begin < batchLimit &&
+                           events[end]->typeOrdinal == events[begin]->typeOrdinal) {
+                        ++end;
+                    }
+                }
+
+                for (std::size_t i = begin; i < end; ++i) {
+                    dispatchEvent(events[i], slot);
+                }
+                if (batchHandlers) {
+                    dispatchBatch(*batchHandlers, events.subspan(begin, end - begin));
+                }
+                begin = end;
+            }
+        }
+
+        /**
+         * @brief Process a single event.
+         * @param event The event to process.
+         */
+        void processSingleEvent(const std::shared_ptr<BaseEvent> &event) {
+            stamp(*event);
+            if (!admitCascade(event) || !admitRate(event))
+                return;
+            dispatchEvents(std::span<const std::shared_ptr<BaseEvent>>(&event, 1));
+        }
+
+        /**
+         * @brief Deliver a single row to the column handlers of its type, if columnar buffering is enabled.
+         * @tparam T The event data type.
+         * @param eventData The event data.
+         */
+        template <ColumnarType T>
+        void processSingleRow(const T &eventData) {
+            detail::ReclaimDomain::Guard guard(reclaimDomain);
+            auto *slot = findSlot(detail::typeOrdinal<T>());
+            auto *base = slot ? slot->columns.load(std::memory_order_acquire) : nullptr;
+            if (!base)
+                return;
+
+            detail::ColumnVectors<T> columns;
+            detail::appendRow(columns, eventData);
+            dispatchColumns(static_cast<detail::ColumnStore<T> &>(*base), ColumnView<T>(columns));
+        }
+
+        /**
+         * @brief Dispatch an event to the per-event handlers of its type.
+         * @param event The event to dispatch.
+         * @param slot The handler slot of the event type, may be null.
+         * @note The caller must hold a reclaim guard.
+         */
+        void dispatchEvent(const std::shared_ptr<BaseEvent> &event, detail::HandlerSlot *slot) {
+            auto startTime = detail::timestampNow(timestampSource.load(std::memory_order_relaxed));
+            neko::uint64 failedHandlers = 0;
+            // Events published by the handlers record this event as their parent
+            detail::DispatchScope scope(event.get());
+
+            static const HandlerList noHandlers;
+            const HandlerList *handlers = slot ? handlerSnapshot(*slot) : nullptr;
+            if (!handlers) {
+                handlers = &noHandlers;
+            }
+
+            bool accepted = false;
+            bool subscribed = false;
+            std::optional<DeadLetter> deadLetter;
+            neko::uint64 rateLimitedCalls = 0;
+            for (const auto &handler : *handlers) {
+                if (!handler->isActive())
+                    continue;
+                subscribed = true;
+                if (auto *limiter = handler->limiter(); limiter && !limiter->tryAcquire(now())) {
+                    ++rateLimitedCalls;
+                    continue;
+                }
+                bool threw = false;
+                auto result = invokeHandler([&handler, &event]() {
+                    return handler->handle(event);
+                }, threw);
+                // Deactivated by itself, e.g. out of invocations or its owner expired
+                if (!handler->isActive()) {
+                    noteExpired(handler->id);
+                }
+                if (result.status == HandlerStatus::Consumed) {
+                    accepted = true;
+                    break;
+                }
+                if (result.status == HandlerStatus::Handled) {
+                    accepted = true;
+                } else if (result.failed() && ++failedHandlers == 1 && deadLetterCapacity.load() > 0) {
+                    deadLetter = DeadLetter{event, threw ? DeadLetterReason::Exception : DeadLetterReason::Failed,
+                                            handler->id, std::move(result.error)};
+                }
+            }
+
+            if (deadLetter) {
+                pushDeadLetter(std::move(*deadLetter));
+            } else if (!accepted && failedHandlers == 0 && deadLetterFiltered.load()) {
+                pushDeadLetter(event, DeadLetterReason::Filtered, 0, !subscribed ? "no subscribers" : "filtered by all handlers");
+            }
+
+            if (rateLimitedCalls > 0 && enableStats.load()) {
+                std::lock_guard<std::mutex> lock(statsMtx);
+                stats.rateLimitedCalls += rateLimitedCalls;
+            }
+            updateStats(false, false, failedHandlers, startTime);
+        }
+
+        /**
+         * @brief Dispatch a run of events of one type to the batch handlers of that type.
+         * @param batchHandlers The batch handlers.
+         * @param events The events, all of the same type.
+         * @note The caller must hold a reclaim guard.
+         */
+        void dispatchBatch(const BatchHandlerList &batchHandlers, std::span<const std::shared_ptr<BaseEvent>> events) {
+            neko::uint64 failedHandlers = 0;
+            // Events published by batch handlers record the first event of the batch as their parent
+            detail::DispatchScope scope(events.front().get());
+            EventBatch batch(events);
+            for (const auto &handler : batchHandlers) {
+                if (!handler->active.load(std::memory_order_acquire))
+                    continue;
+                bool threw = false;
+                auto result = invokeHandler([&handler, &batch]() {
+                    return handler->handleBatch(batch);
+                }, threw);
+                if (result.failed()) {
+                    ++failedHandlers;
+                }
+            }
+
+            if (failedHandlers > 0 && enableStats.load()) {
+                std::lock_guard<std::mutex> lock(statsMtx);
+                stats.failedHandlerCalls += failedHandlers;
+            }
+        }
+
+        /**
+         * @brief Assign the ID, causation and timestamp of an event being published.
+         * @param event The event, keeping the ID and timestamp it already has (e.g. when retried).
+         */
+        void stamp(BaseEvent &event) {
+            detail::stampEvent(event);
+            if (event.timestamp == TimePoint{}) {
+                event.timestamp = detail::timestampNow(timestampSource.load(std::memory_order_relaxed));
+            }
+        }
+
+        /**
+         * @brief Check an event against the rate limit of its type.
+         * @param event The stamped event.
+         * @return True to publish it now, false if it was dropped or deferred.
+         * @details Deferred events are queued by a task once the rate allows, also when published in sync mode.
+         */
+        bool admitRate(const std::shared_ptr<BaseEvent> &event) {
+            if (!hasRateLimits.load(std::memory_order_acquire))
+                return true;
+            auto *slot = findSlot(event->typeOrdinal);
+            auto *limiter = slot ? slot->rateLimiter.load(std::memory_order_acquire) : nullptr;
+            if (!limiter || !limiter->limited())
+                return true;
+
+            auto current = now();
+            auto policy = limiter->getPolicy();
+            if (policy == RateLimitPolicy::Delay) {
+                if (auto release = limiter->reserve(current)) {
+                    if (*release <= current)
+                        return true;
+                    if (enableStats.load()) {
+                        std::lock_guard<std::mutex> lock(statsMtx);
+                        ++stats.delayedEvents;
+                    }
+                    scheduleTaskInternal(*release, [this, event]() { enqueueEvent(event); }, event->priority);
+                    return false;
+                }
+            } else if (limiter->tryAcquire(current)) {
+                return true;
+            }
+
+            if (enableStats.load()) {
+                std::lock_guard<std::mutex> lock(statsMtx);
+                ++stats.rateLimitedEvents;
+            }
+            if (policy != RateLimitPolicy::Drop) {
+                pushDeadLetter(event, DeadLetterReason::RateLimited);
+                if (logger) {
+                    logger("Rate limit exceeded, dropping event #" + std::to_string(event->id));
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Check an event published from a handler against the cascade limits.
+         * @param event The stamped event.
+         * @return False if the event exceeds the maximum cascade depth and was dropped.
+         */
+        bool admitCascade(const std::shared_ptr<BaseEvent> &event) {
+            if (event->depth == 0)
+                return true;
+
+            const BaseEvent *parent = detail::currentDispatch();
+            if (cycleDetection.load(std::memory_order_relaxed) && parent && parent->id == event->parentId) {
+                noteCascadeEdge(*parent, *event);
+            }
+
+            auto limit = maxCascadeDepth.load(std::memory_order_relaxed);
+            bool admitted = limit == 0 || event->depth <= limit;
+            if (enableStats.load()) {
+                std::lock_guard<std::mutex> lock(statsMtx);
+                stats.maxCascadeDepth = std::max(stats.maxCascadeDepth, event->depth);
+                if (!admitted) {
+                    ++stats.cascadeLimitedEvents;
+                }
+            }
+            if (!admitted) {
+                pushDeadLetter(event, DeadLetterReason::Cascade, 0, "cascade depth " + std::to_string(event->depth) + " exceeds " + std::to_string(limit));
+                if (logger) {
+                    logger("Event cascade too deep, dropping event #" + std::to_string(event->id) + " of root #" + std::to_string(event->rootId));
+                }
+            }
+            return admitted;
+        }
+
+        /**
+         * @brief Record that an event of one type published an event of another, reporting new type cycles.
+         * @param parent The event being dispatched.
+         * @param child The event it published.
+         */
+        void noteCascadeEdge(const BaseEvent &parent, const BaseEvent &child) {
+            neko::uint64 edge = (static_cast<neko::uint64>(parent.typeOrdinal) << 32) | static_cast<neko::uint32>(child.typeOrdinal);
+            {
+                std::shared_lock<std::shared_mutex> lock(cascadeMtx);
+                if (cascadeEdges.count(edge))
+                    return;
+            }
+
+            std::unique_lock<std::shared_mutex> lock(cascadeMtx);
+            if (!cascadeEdges.insert(edge).second)
+                return;
+            cascadeGraph[parent.typeOrdinal].push_back(child.typeOrdinal);
+
+            // The new edge closes a cycle if the parent type is reachable from the child type
+            std::vector<std::size_t> pending{child.typeOrdinal};
+            std::unordered_set<std::size_t> visited;
+            bool cycle = false;
+            while (!pending.empty() && !cycle) {
+                auto ordinal = pending.back();
+                pending.pop_back();
+                if (ordinal == parent.typeOrdinal) {
+                    cycle = true;
+                } else if (visited.insert(ordinal).second) {
+                    auto it = cascadeGraph.find(ordinal);
+                    if (it != cascadeGraph.end()) {
+                        pending.insert(pending.end(), it->second.begin(), it->second.end());
+                    }
+                }
+            }
+            lock.unlock();
+
+            if (!cycle)
+                return;
+            if (enableStats.load()) {
+                std::lock_guard<std::mutex> statsLock(statsMtx);
+                ++stats.cascadeCycles;
+            }
+            if (logger) {
+                logger(std::string("Event cascade cycle detected: ") + parent.getType().name() + " -> " + child.getType().name());
+            }
+        }
+
+        /**
+         * @brief Buffer an event in the columnar store of its type, if enabled.
+         * @tparam T The event data type.
+         * @param eventData The event data.
+         * @return True if the event was buffered or dropped by the store, false to publish it as an event.
+         */
+        template <typename T>
+        bool publishColumns(const T &eventData) {
+            if constexpr (ColumnarType<T>) {
+                auto *slot = findSlot(detail::typeOrdinal<T>());
+                auto *base = slot ? slot->columns.load(std::memory_order_acquire) : nullptr;
+                if (!base)
+                    return false;
+
+                // Rows published from handlers are held to the cascade limit one by one
+                if (const BaseEvent *parent = detail::currentDispatch()) {
+                    auto limit = maxCascadeDepth.load(std::memory_order_relaxed);
+                    if (limit != 0 && parent->depth >= limit) {
+                        auto event = std::make_shared<Event<T>>(eventData);
+                        stamp(*event);
+                        admitCascade(event);
+                        return true;
+                    }
+                }
+
+                auto &store = static_cast<detail::ColumnStore<T> &>(*base);
+                switch (store.append(eventData)) {
+                    case detail::ColumnStore<T>::Append::Full:
+                        updateStats(false, true); // dropped event
+                        if (logger) {
+                            logger("Columnar buffer full, dropping event");
+                        }
+                        break;
+                    case detail::ColumnStore<T>::Append::NeedsFlush: {
+                        // Internal, so not subject to the cascade and rate limits; a rejected flush would
+                        // leave the store pending and never flush again
+                        auto flush = std::make_shared<ColumnFlushEvent>(base, &EventLoop::flushColumns<T>);
+                        stamp(*flush);
+                        enqueueEvent(flush);
+                        break;
+                    }
+                    case detail::ColumnStore<T>::Append::Buffered:
+                        break;
+                }
+                return true;
+            } else {
+                return false;
+            }
+        }
+
+        /**
+         * @brief Dispatch the rows buffered in a columnar store.
+         * @tparam T The event data type.
+         * @param base The store.
+         * @details Column handlers receive all rows at once; per-event and batch handlers of T,
+         * if any, receive the rows reassembled into events.
+         */
+        template <ColumnarType T>
+        void flushColumns(detail::ColumnStoreBase &base) {
+            auto &store = static_cast<detail::ColumnStore<T> &>(base);
+            auto columns = store.take();
+            ColumnView<T> view(columns);
+            if (view.empty()) {
+                store.recycle(std::move(columns));
+                return;
+            }
+
+            // Handler snapshots stay alive until the guard is released
+            detail::ReclaimDomain::Guard guard(reclaimDomain);
+            auto *slot = findSlot(detail::typeOrdinal<T>());
+            dispatchColumns(store, view);
+
+            const HandlerList *handlers = slot ? handlerSnapshot(*slot) : nullptr;
+            const BatchHandlerList *batchHandlers = slot ? slot->batchHandlers.load() : nullptr;
+            if ((handlers && !handlers->empty()) || batchHandlers) {
+                std::vector<std::shared_ptr<BaseEvent>> batch;
+                auto limit = std::max<neko::uint64>(maxBatchSize.load(), 1);
+                for (std::size_t begin = 0; begin < view.size(); begin += limit) {
+                    batch.clear();
+                    for (std::size_t i = begin; i < std::min<std::size_t>(view.size(), begin + limit); ++i) {
+                        batch.push_back(std::make_shared<Event<T>>(view.row(i)));
+                        stamp(*batch.back());
+                        dispatchEvent(batch.back(), slot);
+                    }
+                    if (batchHandlers) {
+                        dispatchBatch(*batchHandlers, batch);
+                    }
+                }
+            } else if (enableStats.load()) {
+                std::lock_guard<std::mutex> lock(statsMtx);
+                stats.processedEvents += view.size();
+            }
+
+            store.recycle(std::move(columns));
+        }
+
+        /**
+         * @brief Dispatch rows to the column handlers of a columnar store.
+         * @tparam T The event data type.
+         * @param store The store.
+         * @param view The rows.
+         * @note The caller must hold a reclaim guard.
+         */
+        template <ColumnarType T>
+        void dispatchColumns(detail::ColumnStore<T> &store, const ColumnView<T> &view) {
+            const ColumnHandlerList<T> *columnHandlers = store.handlers.load();
+            if (!columnHandlers)
+                return;
+
+            neko::uint64 failedHandlers = 0;
+            for (const auto &handler : *columnHandlers) {
+                if (!handler->active.load(std::memory_order_acquire))
+                    continue;
+                bool threw = false;
+                auto result = invokeHandler([&handler, &view]() {
+                    return handler->handleColumns(view);
+                }, threw);
+                if (result.failed()) {
+                    ++failedHandlers;
+                }
+            }
+
+            if (failedHandlers > 0 && enableStats.load()) {
+                std::lock_guard<std::mutex> lock(statsMtx);
+                stats.failedHandlerCalls += failedHandlers;
+            }
+        }
+
+        /**
+         * @brief Invoke a handler, converting exceptions into a failed result.
+         * @param invoke Calls the handler and returns its result.
+         * @param threw Set to true if the handler threw an exception.
+         * @return The result of the invocation.
+         */
+        template <typename Invoke>
+        HandlerResult invokeHandler(Invoke &&invoke, [[maybe_unused]] bool &threw) {
+            HandlerResult result;
+#if NEKO_EVENT_ENABLE_EXCEPTIONS
+            try {
+                result = invoke();
+            } catch (const std::exception &e) {
+                threw = true;
+                result = HandlerResult::failure(e.what());
+            } catch (...) {
+                threw = true;
+                result = HandlerResult::failure("unknown exception");
+            }
+#else
+            result = invoke();
+#endif
+            if (result.failed() && logger) {
+                logger("Event handler failed: " + result.error);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Move an event to the dead-letter queue, evicting the oldest entry when full.
+         * @param deadLetter The dead-letter entry.
+         */
+        void pushDeadLetter(DeadLetter deadLetter) {
+            auto capacity = deadLetterCapacity.load();
+            if (capacity == 0)
+                return;
+
+            deadLetter.time = std::chrono::steady_clock::now();
+            deadLetter.attempts = deadLetter.event->retryCount;
+
+            std::lock_guard<std::mutex> lock(deadLetterMtx);
+            while (deadLetters.size() >= capacity) {
+                deadLetters.pop_front();
+            }
+            deadLetters.push_back(std::move(deadLetter));
+        }
+
+        /**
+         * @brief Move an event to the dead-letter queue.
+         * @param event The event.
+         * @param reason Why the event was not delivered.
+         * @param handlerId The related handler ID, if any.
+         * @param message A description of the failure.
+         */
+        void pushDeadLetter(const std::shared_ptr<BaseEvent> &event, DeadLetterReason reason, HandlerId handlerId = 0, std::string message = {}) {
+            if (deadLetterCapacity.load() == 0)
+                return;
+            pushDeadLetter(DeadLetter{event, reason, handlerId, std::move(message)});
+        }
+
+        // === Event methods End ===
+
+        // === Registry methods ===
+
+        /**
+         * @brief Find the handler slot of an event type.
+         * @param ordinal The type ordinal.
+         * @return The slot, or nullptr if the type is not registered.
+         * @note Lock-free once the registry is frozen, except for types registered afterwards.
+         */
+        detail::HandlerSlot *findSlot(std::size_t ordinal) const {
+            if (registryFrozen.load(std::memory_order_acquire)) {
+                if (ordinal < frozenSlots.size() && frozenSlots[ordinal]) {
+                    return frozenSlots[ordinal];
+                }
+                if (!hasLateSlots.load(std::memory_order_acquire)) {
+                    return nullptr;
+                }
+            }
+
+            std::shared_lock<std::shared_mutex> lock(handlerMtx);
+            auto it = handlerSlots.find(ordinal);
+            return it == handlerSlots.end() ? nullptr : it->second.get();
+        }
+
+        /**
+         * @brief Get or create the handler slot of an event type.
+         * @param ordinal The type ordinal.
+         * @return The slot.
+         * @note The caller must hold handlerMtx exclusively.
+         */
+        detail::HandlerSlot &slotFor(std::size_t ordinal) {
+            auto &slot = handlerSlots[ordinal];
+            if (!slot) {
+                slot = std::make_unique<detail::HandlerSlot>();
+                slotDirectory.insert(ordinal, slot.get());
+                if (registryFrozen.load()) {
+                    hasLateSlots.store(true, std::memory_order_release);
+                }
+            }
+            return *slot;
+        }
+
+        /**
+         * @brief Get or create the handler slot of an event type, linking it to its base types.
+         * @tparam T The event data type.
+         * @return The slot.
+         * @note The caller must hold handlerMtx exclusively.
+         */
+        template <typename T>
+        detail::HandlerSlot &registerType() {
+            auto it = handlerSlots.find(detail::typeOrdinal<T>());
+            if (it != handlerSlots.end())
+                return *it->second;
+
+            auto &slot = slotFor(detail::typeOrdinal<T>());
+            if constexpr (detail::hasEventBases<T>) {
+                linkBases<T>(slot, typename EventBases<T>::type{});
+                rebuildHandlers(slot);
+            }
+            return slot;
+        }
+
+        template <typename T, typename... Bases>
+        void linkBases(detail::HandlerSlot &slot, BaseTypes<Bases...>) {
+            (linkBase<T, Bases>(slot), ...);
+        }
+
+        template <typename T, typename Base>
+        void linkBase(detail::HandlerSlot &slot) {
+            static_assert(std::is_base_of_v<Base, T>, "EventBases must list base classes of the event type");
+            auto baseOrdinal = detail::typeOrdinal<Base>();
+            for (const auto &[ordinal, factory] : slot.bases) {
+                if (ordinal == baseOrdinal)
+                    return;
+            }
+
+            registerType<Base>().derived.push_back(detail::typeOrdinal<T>());
+            slot.bases.emplace_back(baseOrdinal, &detail::makeUpcastHandler<T, Base>);
+            linkBases<T>(slot, typename EventBases<Base>::type{});
+        }
+
+        /**
+         * @brief Rebuild the dispatch snapshot of a slot from its own and inherited handlers.
+         * @param slot The slot.
+         * @note The caller must hold handlerMtx exclusively.
          */
-        ScheduledTask(TimePoint t, std::function<void()> cb, EventId eventId, neko::Priority prio = neko::Priority::Normal)
-            : execTime(t), callback(std::move(cb)), id(eventId), priority(prio) {}
+        void rebuildHandlers(detail::HandlerSlot &slot) {
+            slot.stale.store(false, std::memory_order_relaxed);
+            auto handlers = std::make_shared<HandlerList>();
+            handlers->reserve(slot.own.size() - slot.freeHandlers.size());
+            for (const auto &handler : slot.own) {
+                if (handler) {
+                    handlers->push_back(handler);
+                }
+            }
+            for (const auto &[baseOrdinal, factory] : slot.bases) {
+                for (const auto &handler : handlerSlots.at(baseOrdinal)->own) {
+                    if (handler) {
+                        handlers->push_back(factory(handler));
+                    }
+                }
+            }
+            // Priority first, then subscription order, so dispatch never sorts
+            std::sort(handlers->begin(), handlers->end(), [](const auto &lhs, const auto &rhs) {
+                if (lhs->priority != rhs->priority) {
+                    return static_cast<neko::uint8>(lhs->priority) > static_cast<neko::uint8>(rhs->priority);
+                }
+                return lhs->id < rhs->id;
+            });
+            slot.deadHandlers = 0;
+            replaceHandlers(slot, std::move(handlers));
+        }
 
         /**
-         * @brief Compare two scheduled tasks for priority.
-         * @note  execTime > priority > id
+         * @brief Mark the dispatch snapshots of a slot and of all types derived from it as stale.
+         * @param slot The slot.
+         * @details The next dispatch rebuilds them once, however many handlers changed meanwhile.
+         * @note The caller must hold handlerMtx exclusively.
          */
-        bool operator<(const ScheduledTask &other) const {
-            if (execTime != other.execTime) {
-                return execTime > other.execTime;
+        void invalidateHierarchy(detail::HandlerSlot &slot) {
+            slot.stale.store(true, std::memory_order_release);
+            for (auto derivedOrdinal : slot.derived) {
+                handlerSlots.at(derivedOrdinal)->stale.store(true, std::memory_order_release);
             }
-            if (static_cast<neko::uint8>(priority) != static_cast<neko::uint8>(other.priority)) {
-                return static_cast<neko::uint8>(priority) < static_cast<neko::uint8>(other.priority);
+        }
+
+        /**
+         * @brief Get the dispatch snapshot of a slot, rebuilding it first if handlers changed.
+         * @param slot The slot.
+         * @return The snapshot, may be null.
+         * @note The caller must hold a reclaim guard and must not hold handlerMtx.
+         */
+        const HandlerList *handlerSnapshot(detail::HandlerSlot &slot) {
+            if (slot.stale.load(std::memory_order_acquire)) {
+                std::unique_lock<std::shared_mutex> lock(handlerMtx);
+                if (slot.stale.load(std::memory_order_relaxed)) {
+                    rebuildHandlers(slot);
+                }
             }
-            return id > other.id;
+            return slot.handlers.load();
         }
-        bool operator>(const ScheduledTask &other) const {
-            return other < *this;
+
+        /**
+         * @brief Check whether a per-event handler of one of the given base types is active.
+         * @details Base handlers are counted in the slot of the type they subscribed to, so each
+         * declared base is visited, registered or not, the way registering the derived type links them.
+         */
+        template <typename... Bases>
+        bool hasBaseSubscribers(BaseTypes<Bases...>) const {
+            return (hasBaseSubscriber<Bases>() || ...);
         }
-    };
 
-    /**
-     * @class EventLoop
-     * @brief Event loop class that manages event handling and task scheduling.
-     */
-    class EventLoop {
-    private:
-        // === Member variables ===
+        template <typename Base>
+        bool hasBaseSubscriber() const {
+            auto *slot = slotDirectory.find(detail::typeOrdinal<Base>());
+            if (slot && slot->activeHandlers.load(std::memory_order_acquire) > 0)
+                return true;
+            if constexpr (detail::hasEventBases<Base>) {
+                return hasBaseSubscribers(typename EventBases<Base>::type{});
+            }
+            return false;
+        }
 
-        // Task scheduling
-        std::priority_queue<ScheduledTask> taskQueue;
-        mutable std::mutex taskMtx;
-        std::condition_variable taskCv;
-        std::atomic<bool> stop;
-        std::atomic<EventId> nextTaskId{1};
-        std::unordered_set<EventId> cancelledTasks;
+        /**
+         * @brief Make sure types with declared bases are registered before publishing.
+         * @tparam T The event data type.
+         * @details Otherwise handlers of the base types would not see the event.
+         */
+        template <typename T>
+        void prepareType() {
+            if constexpr (detail::hasEventBases<T>) {
+                if (!findSlot(detail::typeOrdinal<T>())) {
+                    registerEventType<T>();
+                }
+            }
+        }
 
-        // Event system
-        std::unordered_map<std::type_index, std::vector<std::shared_ptr<BaseEventHandler>>> eventHandlers;
-        std::queue<std::shared_ptr<BaseEvent>> eventQueue;
-        mutable std::shared_mutex eventMtx;
-        std::condition_variable_any eventCv;
-        std::atomic<HandlerId> nextHandlerId{1};
+        /**
+         * @brief Replace the handler list of a slot, retiring the previous snapshot.
+         * @param slot The slot.
+         * @param handlers The new handler list.
+         * @note The caller must hold handlerMtx exclusively.
+         */
+        void replaceHandlers(detail::HandlerSlot &slot, std::shared_ptr<const HandlerList> handlers) {
+            slot.handlers.store(handlers.get());
+            reclaimDomain.retire(std::move(slot.owner));
+            slot.owner = std::move(handlers);
+        }
 
-        // Enhanced features e.g. statistics, logging
-        std::atomic<bool> enableStats{true};
-        EventStats stats;
-        mutable std::mutex statsMtx;
-        neko::uint64 maxQueueSize = 100000;
-        std::function<void(const std::string &)> logger;
+        /**
+         * @brief Replace the batch handler list of a slot, retiring the previous snapshot.
+         * @param slot The slot.
+         * @param batchHandlers The new batch handler list, null if empty.
+         * @note The caller must hold handlerMtx exclusively.
+         */
+        void replaceBatchHandlers(detail::HandlerSlot &slot, std::shared_ptr<const BatchHandlerList> batchHandlers) {
+            if (batchHandlers && batchHandlers->empty()) {
+                batchHandlers.reset();
+            }
+            slot.batchHandlers.store(batchHandlers.get());
+            reclaimDomain.retire(std::move(slot.batchOwner));
+            slot.batchOwner = std::move(batchHandlers);
+        }
 
-        // Event loop control
-        mutable std::mutex loopMtx;
-        std::condition_variable loopCv;
+        /**
+         * @brief Replace the column handler list of a columnar store, retiring the previous snapshot.
+         * @param store The store.
+         * @param columnHandlers The new column handler list, null if empty.
+         * @note The caller must hold handlerMtx exclusively.
+         */
+        template <ColumnarType T>
+        void replaceColumnHandlers(detail::ColumnStore<T> &store, std::shared_ptr<const ColumnHandlerList<T>> columnHandlers) {
+            if (columnHandlers && columnHandlers->empty()) {
+                columnHandlers.reset();
+            }
+            store.handlers.store(columnHandlers.get());
+            reclaimDomain.retire(std::move(store.owner));
+            store.owner = std::move(columnHandlers);
+        }
 
-    private:
-        // === Internal methods ===
+        /**
+         * @brief Drop unsubscribed handlers from a handler list once they make up half of it.
+         * @param slot The slot.
+         * @param kind The handler list to compact.
+         * @details Unsubscribing only clears the handler's active flag, so rebuilding the list
+         * here keeps the cost of unsubscribing amortized O(1). Per-event handler snapshots are only
+         * marked stale and rebuilt by the next dispatch.
+         * @note The caller must hold handlerMtx exclusively.
+         */
+        void compactHandlers(detail::HandlerSlot &slot, detail::HandlerKind kind) {
+            switch (kind) {
+            case detail::HandlerKind::Event:
+                // Freed positions are reused, the snapshot still lists the dead handlers until rebuilt
+                if (slot.deadHandlers * 2 < slot.own.size() - slot.freeHandlers.size() + slot.deadHandlers)
+                    return;
+                invalidateHierarchy(slot);
+                break;
+            case detail::HandlerKind::Batch: {
+                if (!slot.batchOwner || slot.deadBatchHandlers * 2 < slot.batchOwner->size())
+                    return;
+                auto batchHandlers = std::make_shared<BatchHandlerList>();
+                std::copy_if(slot.batchOwner->begin(), slot.batchOwner->end(), std::back_inserter(*batchHandlers),
+                             [](const std::shared_ptr<BaseBatchHandler> &handler) {
+                                 return handler->active.load();
+                             });
+                slot.deadBatchHandlers = 0;
+                replaceBatchHandlers(slot, std::move(batchHandlers));
+                break;
+            }
+            case detail::HandlerKind::Column:
+                if (!slot.columnOwner || slot.columnOwner->deadHandlers * 2 < slot.columnOwner->handlerCount())
+                    return;
+                slot.columnOwner->compactHandlers(reclaimDomain);
+                break;
+            }
+        }
 
-        // === Event methods ===
         /**
-         * @brief Publish an event to the event queue.
-         * @param event The event to publish.
+         * @brief Add an event handler to the registry.
+         * @tparam T The event data type.
+         * @param eventHandler The handler.
+         * @param minPriority The minimum priority to handle.
+         * @param handlerPriority The order of this handler, higher priority handlers run first.
+         * @return The handler ID.
          */
-        void publishEvent(const std::shared_ptr<BaseEvent> &event) {
-            std::unique_lock<std::shared_mutex> lock(eventMtx);
+        template <typename T>
+        HandlerId addHandler(std::shared_ptr<FilteredEventHandler<T>> eventHandler, neko::Priority minPriority, neko::Priority handlerPriority) {
+            eventHandler->id = nextHandlerId.fetch_add(1);
+            eventHandler->priority = handlerPriority;
+            eventHandler->setMinPriority(minPriority);
 
-            if (eventQueue.size() >= maxQueueSize) {
-                updateStats(false, true); // dropped event
-                if (logger) {
-                    lock.unlock();
-                    logger("Event queue overflow, dropping event");
+            {
+                std::unique_lock<std::shared_mutex> lock(handlerMtx);
+                removeExpiredHandlers();
+                auto &slot = registerType<T>();
+
+                // Stored in a free position, the snapshot is rebuilt in order by the next dispatch
+                std::size_t position = slot.own.size();
+                if (slot.freeHandlers.empty()) {
+                    slot.own.push_back(eventHandler);
+                } else {
+                    position = slot.freeHandlers.back();
+                    slot.freeHandlers.pop_back();
+                    slot.own[position] = eventHandler;
                 }
-                return;
+                eventHandler->subscriberCount = &slot.activeHandlers;
+                slot.activeHandlers.fetch_add(1, std::memory_order_release);
+                invalidateHierarchy(slot);
+                handlerIndex.emplace(eventHandler->id,
+                                     detail::HandlerRecord{detail::typeOrdinal<T>(), detail::HandlerKind::Event, &eventHandler->active, position});
             }
+            reclaimDomain.reclaim();
 
-            eventQueue.push(event);
-            lock.unlock();
-
-            // notify the event loop
-            eventCv.notify_one();
-            loopCv.notify_one();
+            return eventHandler->id;
         }
 
         /**
-         * @brief Process all events in the event queue.
-         * @return True if any events were processed, false otherwise.
+         * @brief Unsubscribe a handler by ID.
+         * @param handlerId The handler ID.
+         * @param ordinal The type ordinal the handler must belong to, or npos for any type.
+         * @return True if unsubscribed, false otherwise.
+         * @note The caller must hold handlerMtx exclusively.
          */
-        bool processEvents() {
-            bool processedAny = false;
+        bool removeHandler(HandlerId handlerId, std::size_t ordinal) {
+            auto it = handlerIndex.find(handlerId);
+            if (it == handlerIndex.end())
+                return false;
+            if (ordinal != std::numeric_limits<std::size_t>::max() && it->second.typeOrdinal != ordinal)
+                return false;
 
-            while (!stop.load()) {
-                std::shared_ptr<BaseEvent> event;
-                {
-                    std::unique_lock<std::shared_mutex> lock(eventMtx);
-                    if (eventQueue.empty())
-                        break;
-                    event = eventQueue.front();
-                    eventQueue.pop();
-                    processedAny = true;
-                }
-                processSingleEvent(event);
+            auto record = it->second;
+            handlerIndex.erase(it);
+
+            auto &slot = *handlerSlots.at(record.typeOrdinal);
+            if (record.kind == detail::HandlerKind::Event) {
+                // Counted once, whether it expired by itself before or is deactivated here
+                slot.own[record.position]->deactivate();
+            } else {
+                record.active->store(false, std::memory_order_release);
+                slot.activeBulkHandlers.fetch_sub(1, std::memory_order_release);
+            }
+            switch (record.kind) {
+            case detail::HandlerKind::Event:
+                slot.own[record.position].reset();
+                slot.freeHandlers.push_back(record.position);
+                ++slot.deadHandlers;
+                break;
+            case detail::HandlerKind::Batch:
+                ++slot.deadBatchHandlers;
+                break;
+            case detail::HandlerKind::Column:
+                ++slot.columnOwner->deadHandlers;
+                break;
             }
+            compactHandlers(slot, record.kind);
+            return true;
+        }
 
-            return processedAny;
+        /**
+         * @brief Record that a handler deactivated itself, e.g. out of invocations or its owner expired.
+         * @param handlerId The handler ID.
+         * @details Called from dispatch, the handler is removed from the registry later by
+         * removeExpiredHandlers() so dispatch never takes the registry lock exclusively.
+         */
+        void noteExpired(HandlerId handlerId) {
+            std::lock_guard<std::mutex> lock(expiredMtx);
+            expiredHandlers.push_back(handlerId);
+            hasExpiredHandlers.store(true, std::memory_order_release);
         }
 
         /**
-         * @brief Process a single event.
-         * @param event The event to process.
+         * @brief Remove the handlers that deactivated themselves from the registry.
+         * @note The caller must hold handlerMtx exclusively.
          */
-        void processSingleEvent(const std::shared_ptr<BaseEvent> &event) {
-            auto startTime = std::chrono::steady_clock::now();
-            bool success = true;
+        void removeExpiredHandlers() {
+            if (!hasExpiredHandlers.load(std::memory_order_acquire))
+                return;
 
-            try {
-                std::shared_lock<std::shared_mutex> lock(eventMtx);
-                auto typeIndex = event->getType();
-                auto it = eventHandlers.find(typeIndex);
-
-                if (it != eventHandlers.end()) {
-                    // Copy handler list to avoid modification during processing
-                    auto handlers = it->second;
-                    lock.unlock();
-
-                    for (const auto &handler : handlers) {
-                        try {
-                            handler->handle(event);
-                        } catch (const std::exception &e) {
-                            success = false;
-                            if (logger) {
-                                logger("Event handler failed: " + std::string(e.what()));
-                            }
-                        } catch (...) {
-                            success = false;
-                            if (logger) {
-                                logger("Event handler failed: unknown exception");
-                            }
-                        }
-                    }
-                }
-            } catch (const std::exception &e) {
-                success = false;
-                if (logger) {
-                    logger("Event processing failed: " + std::string(e.what()));
-                }
-            } catch (...) {
-                success = false;
-                if (logger) {
-                    logger("Event handler failed: unknown exception");
-                }
+            std::vector<HandlerId> expired;
+            {
+                std::lock_guard<std::mutex> lock(expiredMtx);
+                expired.swap(expiredHandlers);
+                hasExpiredHandlers.store(false, std::memory_order_relaxed);
             }
+            // An ID may be noted twice or unsubscribed meanwhile, removeHandler() ignores unknown IDs
+            for (auto handlerId : expired) {
+                removeHandler(handlerId, std::numeric_limits<std::size_t>::max());
+            }
+        }
 
-            updateStats(false, false, !success, startTime);
+        /**
+         * @brief Remove expired handlers if the registry lock is free, called between dispatches.
+         */
+        void purgeExpiredHandlers() {
+            if (!hasExpiredHandlers.load(std::memory_order_acquire))
+                return;
+            {
+                std::unique_lock<std::shared_mutex> lock(handlerMtx, std::try_to_lock);
+                if (!lock.owns_lock())
+                    return;
+                removeExpiredHandlers();
+            }
+            reclaimDomain.reclaim();
         }
 
-        // === Event methods End ===
+        // === Registry methods End ===
 
         // === Task methods ===
 
         /**
          * @brief Process scheduled tasks.
          * @details If there are tasks ready to execute, execute them immediately and return the next task's execution time.
+         * Each repeating task runs at most once per call: it is requeued for its next interval after the pass,
+         * skipping the intervals that already passed, so a slow or busy task cannot keep the pass from returning.
+         * @param deadline Stop executing due tasks once this time is reached.
+         * @param untilStop Whether to stop when stopLoop() is called.
+         * @param held If set, receives the repeating tasks that ran instead of requeueing them.
          * @return The next task execution time, if any.
          * If no tasks are scheduled, returns std::nullopt.
          */
-        std::optional<TimePoint> processScheduledTasks() {
+        std::optional<TimePoint> processScheduledTasks(std::optional<TimePoint> deadline = std::nullopt, bool untilStop = true,
+                                                       std::vector<ScheduledTask> *held = nullptr) {
             std::unique_lock<std::mutex> lock(taskMtx);
-            auto now = std::chrono::steady_clock::now();
+            auto now = clock->now();
+            std::vector<ScheduledTask> rescheduled;
+            std::optional<TimePoint> nextTime;
 
-            while (!taskQueue.empty() && !stop.load()) {
+            while (!taskQueue.empty() && !(untilStop && stop.load())) {
                 auto next = taskQueue.top();
 
-                // handle cancelled tasks
-                if (cancelledTasks.find(next.id) != cancelledTasks.end()) {
-                    taskQueue.pop();
-                    if (!next.repeating) {
-                        cancelledTasks.erase(next.id);
-                    }
-                    continue;
-                }
+                // Leave due tasks for later once the time budget is spent
+                if (deadline && std::chrono::steady_clock::now() >= *deadline) {
+                    nextTime = next.execTime;
+                    break;
+                }
+
+                // handle cancelled tasks
+                if (cancelledTasks.find(next.id) != cancelledTasks.end()) {
+                    taskQueue.pop();
+                    if (!next.repeating) {
+                        cancelledTasks.erase(next.id);
+                    }
+                    continue;
+                }
+
+                // If the task's execution time has not arrived, return the next task's time
+                if (now < next.execTime) {
+                    nextTime = next.execTime;
+                    break;
+                }
+
+                // Execute the task
+                taskQueue.pop();
+                lock.unlock();
+
+#if NEKO_EVENT_ENABLE_EXCEPTIONS
+                try {
+                    next.callback();
+                } catch (const std::exception &e) {
+                    if (logger) {
+                        logger("Scheduled task failed: " + std::string(e.what()));
+                    }
+                } catch (...) {
+                    if (logger) {
+                        logger("Scheduled task failed: unknown exception");
+                    }
+                }
+#else
+                next.callback();
+#endif
+
+                lock.lock();
+                now = clock->now();
+                // Repeating tasks keep their phase but skip the intervals missed while the task or the loop was busy
+                if (next.repeating && cancelledTasks.find(next.id) == cancelledTasks.end()) {
+                    next.execTime += next.interval;
+                    if (next.execTime <= now) {
+                        next.execTime += next.interval * ((now - next.execTime) / next.interval + 1);
+                    }
+                    (held ? *held : rescheduled).push_back(std::move(next));
+                }
+            }
+
+            for (auto &task : rescheduled) {
+                if (!nextTime || task.execTime < *nextTime) {
+                    nextTime = task.execTime;
+                }
+                taskQueue.push(std::move(task));
+            }
+            if (untilStop && stop.load()) {
+                return std::nullopt;
+            }
+            return nextTime;
+        }
+
+        /**
+         * @brief Internal implementation of scheduling tasks.
+         * @param t The execution time.
+         * @param cb The callback function.
+         * @param priority The priority.
+         * @return The scheduled task ID.
+         */
+        EventId scheduleTaskInternal(TimePoint t, std::function<void()> cb, neko::Priority priority) {
+            EventId id = nextTaskId.fetch_add(1);
+            {
+                std::lock_guard<std::mutex> lock(taskMtx);
+                ScheduledTask task{t, std::move(cb), id, priority};
+                taskQueue.push(std::move(task));
+            }
+
+            // Notify the task processor and event loop
+            taskCv.notify_one();
+            notifyLoop();
+
+            return id;
+        }
+
+        /**
+         * @brief Schedule the next tick of a stream operator timer.
+         * @param state The operator state, with a `feed` member referring to its feed handler.
+         * @param due When the tick runs.
+         * @param tick Called with the state and the due time, returns the time of the next tick, if any.
+         * @details Ticks stop once the feed handler is unsubscribed or destroyed.
+         */
+        template <typename State, typename Tick>
+        void scheduleOperatorTick(const std::shared_ptr<State> &state, TimePoint due, Tick tick) {
+            scheduleTaskInternal(due, [this, weakState = std::weak_ptr<State>(state), due, tick]() {
+                auto current = weakState.lock();
+                if (!current)
+                    return;
+                auto feed = current->feed.lock();
+                if (!feed || !feed->isActive())
+                    return;
+                if (auto next = tick(*current, due)) {
+                    scheduleOperatorTick(current, *next, tick);
+                }
+            }, neko::Priority::Normal);
+        }
+
+        /**
+         * @brief Count a failed operator callback invoked from a timer, outside of dispatch.
+         * @param result The callback's result.
+         */
+        void countOperatorResult(const HandlerResult &result) {
+            if (result.failed() && enableStats.load()) {
+                std::lock_guard<std::mutex> lock(statsMtx);
+                ++stats.failedHandlerCalls;
+            }
+        }
+
+        // === Task methods End ===
+
+        /**
+         * @brief Register the calling thread as a runner of the loop.
+         * @details Waits while a previous shutdown is still draining.
+         */
+        void enterRun() {
+            std::unique_lock<std::mutex> lock(loopMtx);
+            drainedCv.wait(lock, [this]() { return state.load() != LoopState::Draining; });
+            ++activeRunners;
+            state.store(LoopState::Running);
+        }
+
+        /**
+         * @brief Unregister the calling thread as a runner of the loop.
+         * @details The last runner to leave finishes a requested stop and moves the loop to Stopped.
+         */
+        void exitRun() {
+            std::unique_lock<std::mutex> lock(loopMtx);
+            if (--activeRunners > 0)
+                return;
+
+            if (shutdownPending) {
+                state.store(LoopState::Draining);
+                lock.unlock();
+                finishShutdown();
+                lock.lock();
+            }
+            state.store(LoopState::Stopped);
+            drainedCv.notify_all();
+        }
+
+        /**
+         * @brief Finish a stop requested by stopLoop().
+         * @details Drains queued work as requested by the shutdown mode, then discards what is left.
+         * The stop request itself stays in effect until restart().
+         */
+        void finishShutdown() {
+            ShutdownMode mode;
+            std::optional<TimePoint> deadline;
+            {
+                std::lock_guard<std::mutex> lock(loopMtx);
+                mode = shutdownMode;
+                deadline = shutdownDeadline;
+                shutdownMode = ShutdownMode::Immediate;
+                shutdownDeadline.reset();
+                shutdownPending = false;
+            }
 
-                // If the task's execution time has not arrived, return the next task's time
-                if (now < next.execTime) {
-                    return next.execTime;
+            // Repeating tasks run at most once while draining, then wait for a restart
+            std::vector<ScheduledTask> heldTasks;
+            while (mode != ShutdownMode::Immediate) {
+                if (mode == ShutdownMode::DrainAll) {
+                    processScheduledTasks(deadline, false, &heldTasks);
                 }
+                auto processed = processEvents(std::numeric_limits<std::size_t>::max(), deadline, false);
 
-                // Execute the task
-                taskQueue.pop();
-                lock.unlock();
+                if (deadline && std::chrono::steady_clock::now() >= *deadline)
+                    break;
+                // Handlers may have scheduled tasks that are already due
+                bool tasksDue = mode == ShutdownMode::DrainAll && hasDueTasks();
+                if (processed == 0 && !tasksDue)
+                    break;
+            }
 
-                try {
-                    next.callback();
-                } catch (const std::exception &e) {
-                    if (logger) {
-                        logger("Scheduled task failed: " + std::string(e.what()));
-                    }
-                } catch (...) {
-                    if (logger) {
-                        logger("Scheduled task failed: unknown exception");
-                    }
+            if (!heldTasks.empty()) {
+                std::lock_guard<std::mutex> lock(taskMtx);
+                for (auto &task : heldTasks) {
+                    taskQueue.push(std::move(task));
                 }
+            }
 
-                lock.lock();
-                now = std::chrono::steady_clock::now();
+            auto discarded = discardQueuedEvents();
+            if (discarded > 0 && logger) {
+                logger("Event loop stopped, discarding " + std::to_string(discarded) + " events");
             }
+        }
 
-            return std::nullopt;
+        /**
+         * @brief Check whether a scheduled task is due.
+         * @return True if a task that is not cancelled is due.
+         * @details Looks at the earliest task only; cancelled tasks in front of it are dropped
+         * as processScheduledTasks() would.
+         */
+        bool hasDueTasks() {
+            std::lock_guard<std::mutex> lock(taskMtx);
+            while (!taskQueue.empty()) {
+                const auto &next = taskQueue.top();
+                auto cancelled = cancelledTasks.find(next.id);
+                if (cancelled == cancelledTasks.end())
+                    return next.execTime <= clock->now();
+                if (!next.repeating) {
+                    cancelledTasks.erase(cancelled);
+                }
+                taskQueue.pop();
+            }
+            return false;
         }
 
         /**
-         * @brief Internal implementation of scheduling tasks.
-         * @param t The execution time.
-         * @param cb The callback function.
-         * @param priority The priority.
-         * @return The scheduled task ID.
+         * @brief Discard the queued events, counting them in discardedEvents and dead-lettering them as Expired.
+         * @return The number of discarded events.
          */
-        EventId scheduleTaskInternal(TimePoint t, std::function<void()> cb, neko::Priority priority) {
-            EventId id = nextTaskId.fetch_add(1);
+        neko::uint64 discardQueuedEvents() {
+            std::vector<std::shared_ptr<BaseEvent>> events;
             {
-                std::lock_guard<std::mutex> lock(taskMtx);
-                ScheduledTask task{t, std::move(cb), id, priority};
-                taskQueue.push(std::move(task));
+                std::unique_lock<std::shared_mutex> lock(eventMtx);
+                events = eventQueue.takeAll();
+                eventQueueBytes = 0;
             }
 
-            // Notify the task processor and event loop
-            taskCv.notify_one();
-            loopCv.notify_one();
+            neko::uint64 discarded = 0;
+            for (const auto &event : events) {
+                if (event->typeOrdinal == detail::typeOrdinal<ColumnFlushEvent>()) {
+                    discarded += static_cast<ColumnFlushEvent &>(*event).store->discard();
+                } else {
+                    ++discarded;
+                    pushDeadLetter(event, DeadLetterReason::Expired, 0, "discarded at shutdown");
+                }
+            }
 
-            return id;
+            if (discarded > 0 && enableStats.load()) {
+                std::lock_guard<std::mutex> lock(statsMtx);
+                stats.discardedEvents += discarded;
+            }
+            return discarded;
         }
 
-        // === Task methods End ===
-
         /**
          * @brief Wait for work in the event loop.
          * @details Waits for either a new event, a scheduled task, or a stop signal.
-         * @param nextTaskTime The next scheduled task time.
+         * @param nextTaskTime The next scheduled task time, on the scheduler clock.
          * @param maxWaitTime The maximum wait time.
          */
         void waitForWork(const std::optional<TimePoint> &nextTaskTime,
@@ -461,23 +3795,46 @@ namespace neko::event {
             auto waitUntil = now + maxWaitTime;
 
             if (nextTaskTime.has_value()) {
-                waitUntil = std::min(waitUntil, *nextTaskTime);
+                // The scheduler clock may differ from the steady clock used for waiting
+                waitUntil = std::min(waitUntil, now + (*nextTaskTime - clock->now()));
             }
 
             // Wait until:
             // 1. There is a new event or task (notify)
             // 2. The wait time is reached (maxWaitTime or nextTaskTime)
-            loopCv.wait_until(lock, waitUntil);
+            ++idleRunners;
+            loopCv.wait_until(lock, waitUntil, [this]() {
+                return wakePending.exchange(false) || stop.load();
+            });
+            --idleRunners;
+        }
+
+        /**
+         * @brief Wake up the threads waiting for work.
+         * @param all Whether to wake all of them, otherwise one.
+         * @details Locks loopMtx only while a thread is idle, so a thread that checked for work
+         * but is not waiting yet cannot miss the wake-up.
+         */
+        void notifyLoop(bool all = false) {
+            wakePending.store(true);
+            if (idleRunners.load() > 0) {
+                std::lock_guard<std::mutex> lock(loopMtx);
+            }
+            if (all) {
+                loopCv.notify_all();
+            } else {
+                loopCv.notify_one();
+            }
         }
 
         /**
          * @brief Update event statistics.
          * @param isNewEvent Whether this is a new event.
          * @param isDropped Whether the event was dropped.
-         * @param isFailed Whether the event processing failed.
-         * @param startTime The start time of processing.
+         * @param failedHandlers The number of handlers that failed while processing the event.
+         * @param startTime The start time of processing from the timestamp source, empty to skip timing.
          */
-        void updateStats(bool isNewEvent = false, bool isDropped = false, bool isFailed = false, TimePoint startTime = TimePoint{}) {
+        void updateStats(bool isNewEvent = false, bool isDropped = false, neko::uint64 failedHandlers = 0, TimePoint startTime = TimePoint{}) {
             if (!enableStats.load())
                 return;
 
@@ -486,14 +3843,15 @@ namespace neko::event {
                 ++stats.totalEvents;
             } else if (isDropped) {
                 ++stats.droppedEvents;
-            } else if (isFailed) {
+            } else if (failedHandlers > 0) {
                 ++stats.failedEvents;
+                stats.failedHandlerCalls += failedHandlers;
             } else {
                 // Successfully processed event
                 ++stats.processedEvents;
                 if (startTime != TimePoint{}) {
                     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-                        std::chrono::steady_clock::now() - startTime);
+                        detail::timestampNow(timestampSource.load(std::memory_order_relaxed)) - startTime);
 
                     // Update average processing time
                     if (stats.processedEvents == 1) {
@@ -521,49 +3879,259 @@ namespace neko::event {
         /**
          * @brief Subscribe to an event type.
          * @tparam T The event data type.
-         * @param handler The handler function.
+         * @param handler The handler function, taking either `const T &` or `std::shared_ptr<const T>`
+         * and returning either void or HandlerResult.
          * @param minPriority The minimum priority to handle.
+         * @param handlerPriority The order of this handler, higher priority handlers run first.
          * @return The handler ID.
+         * @note Handlers returning HandlerResult::failure() are counted as failed without throwing.
+         * @note Handlers returning HandlerResult::consumed() stop propagation to lower priority handlers.
+         * @note Handlers taking `std::shared_ptr<const T>` share the payload and can forward it without copying.
          */
-        template <typename T>
-        HandlerId subscribe(std::function<void(const T &)> handler,
-                            neko::Priority minPriority = neko::Priority::Low) {
-            std::unique_lock<std::shared_mutex> lock(eventMtx);
-            auto eventHandler = std::make_shared<EventHandler<T>>(std::move(handler));
-            eventHandler->id = nextHandlerId.fetch_add(1);
-            eventHandler->setMinPriority(minPriority);
+        template <typename T, typename Handler>
+            requires(std::is_invocable_v<Handler &, const T &> || std::is_invocable_v<Handler &, std::shared_ptr<const T>>)
+        HandlerId subscribe(Handler &&handler,
+                            neko::Priority minPriority = neko::Priority::Low,
+                            neko::Priority handlerPriority = neko::Priority::Normal) {
+            return addHandler<T>(std::make_shared<EventHandler<T>>(std::forward<Handler>(handler)), minPriority, handlerPriority);
+        }
+
+        /**
+         * @brief Subscribe a member function of an object to an event type, without extending the object's lifetime.
+         * @tparam T The event data type.
+         * @param owner The object, held by a weak reference.
+         * @param method The member function, taking `const T &` and returning either void or HandlerResult.
+         * @param minPriority The minimum priority to handle.
+         * @param handlerPriority The order of this handler, higher priority handlers run first.
+         * @return The handler ID.
+         * @details The member function is called directly, without a std::function wrapper. Once the
+         * object is destroyed the handler is skipped and removed from the registry between dispatches.
+         */
+        template <typename T, typename Owner, typename Method>
+            requires(std::is_member_function_pointer_v<Method> && std::is_invocable_v<Method, Owner &, const T &>)
+        HandlerId subscribe(std::weak_ptr<Owner> owner, Method method,
+                            neko::Priority minPriority = neko::Priority::Low,
+                            neko::Priority handlerPriority = neko::Priority::Normal) {
+            return addHandler<T>(std::make_shared<MemberEventHandler<T, Owner, Method>>(std::move(owner), method),
+                                 minPriority, handlerPriority);
+        }
 
-            auto typeIndex = std::type_index(typeid(T));
-            eventHandlers[typeIndex].push_back(eventHandler);
+        /**
+         * @brief Subscribe to an event type for a limited number of events.
+         * @tparam T The event data type.
+         * @param count The number of events to handle, 0 subscribes nothing.
+         * @param handler The handler function, as for subscribe().
+         * @param minPriority The minimum priority to handle.
+         * @param handlerPriority The order of this handler, higher priority handlers run first.
+         * @return The handler ID, or 0 if count is 0.
+         * @details The handler runs exactly count times, also with several workers, and then
+         * unsubscribes itself. Events rejected by the minimum priority or by filters do not count.
+         * The registry entry is removed between dispatches, never by the dispatching handler.
+         */
+        template <typename T, typename Handler>
+            requires(std::is_invocable_v<Handler &, const T &> || std::is_invocable_v<Handler &, std::shared_ptr<const T>>)
+        HandlerId subscribeN(neko::uint64 count, Handler &&handler,
+                             neko::Priority minPriority = neko::Priority::Low,
+                             neko::Priority handlerPriority = neko::Priority::Normal) {
+            if (count == 0)
+                return 0;
+            auto eventHandler = std::make_shared<EventHandler<T>>(std::forward<Handler>(handler));
+            eventHandler->shots.store(static_cast<neko::int64>(std::min<neko::uint64>(count, std::numeric_limits<neko::int64>::max())));
+            return addHandler<T>(std::move(eventHandler), minPriority, handlerPriority);
+        }
 
-            return eventHandler->id;
+        /**
+         * @brief Subscribe to the next event of a type.
+         * @tparam T The event data type.
+         * @param handler The handler function, as for subscribe().
+         * @param minPriority The minimum priority to handle.
+         * @param handlerPriority The order of this handler, higher priority handlers run first.
+         * @return The handler ID.
+         * @note Add a filter with addFilter() to wait for a specific event, e.g. a response to a request.
+         */
+        template <typename T, typename Handler>
+            requires(std::is_invocable_v<Handler &, const T &> || std::is_invocable_v<Handler &, std::shared_ptr<const T>>)
+        HandlerId subscribeOnce(Handler &&handler,
+                                neko::Priority minPriority = neko::Priority::Low,
+                                neko::Priority handlerPriority = neko::Priority::Normal) {
+            return subscribeN<T>(1, std::forward<Handler>(handler), minPriority, handlerPriority);
+        }
+
+        /**
+         * @brief Subscribe a batch handler to an event type.
+         * @tparam T The event data type, must be copy constructible.
+         * @param handler The handler function taking `std::span<const T>`, returning either void or HandlerResult.
+         * @param minPriority The minimum priority to handle.
+         * @return The handler ID.
+         * @details Consecutive queued events of type T (up to the maximum batch size) are delivered
+         * in one call, with their data copied into a contiguous buffer. Events published in sync mode
+         * are delivered as batches of one. Batch handlers only receive events of exactly type T.
+         */
+        template <typename T, typename Handler>
+            requires std::is_invocable_v<Handler &, std::span<const T>>
+        HandlerId subscribeBatch(Handler &&handler, neko::Priority minPriority = neko::Priority::Low) {
+            auto batchHandler = std::make_shared<BatchEventHandler<T>>(std::forward<Handler>(handler));
+            auto handlerId = nextHandlerId.fetch_add(1);
+            batchHandler->id = handlerId;
+            batchHandler->setMinPriority(minPriority);
+
+            {
+                std::unique_lock<std::shared_mutex> lock(handlerMtx);
+                auto &slot = registerType<T>();
+                handlerIndex.emplace(handlerId,
+                                     detail::HandlerRecord{detail::typeOrdinal<T>(), detail::HandlerKind::Batch, &batchHandler->active});
+                auto batchHandlers = slot.batchOwner ? std::make_shared<BatchHandlerList>(*slot.batchOwner) : std::make_shared<BatchHandlerList>();
+                batchHandlers->push_back(std::move(batchHandler));
+                slot.activeBulkHandlers.fetch_add(1, std::memory_order_release);
+                replaceBatchHandlers(slot, std::move(batchHandlers));
+            }
+            reclaimDomain.reclaim();
+
+            return handlerId;
+        }
+
+        /**
+         * @brief Buffer events of a type in columnar (structure-of-arrays) form.
+         * @tparam T The event data type, with a ColumnLayout specialization.
+         * @param maxRows The maximum number of buffered rows, 0 uses the maximum queue size.
+         * @details Events of T published asynchronously are stored field by field in contiguous arrays
+         * instead of being queued one by one, and the event queue holds a single entry for all rows
+         * buffered since the last dispatch. Rows carry no per-event header: priorities are not kept.
+         * Per-event and batch handlers of T still receive every row, reassembled into an event.
+         * Enabling is permanent for the lifetime of the loop.
+         */
+        template <ColumnarType T>
+        void enableColumnar(neko::uint64 maxRows = 0) {
+            std::unique_lock<std::shared_mutex> lock(handlerMtx);
+            auto &slot = registerType<T>();
+            if (slot.columnOwner)
+                return;
+
+            if (maxRows == 0) {
+                std::shared_lock<std::shared_mutex> eventLock(eventMtx);
+                maxRows = maxQueueSize;
+            }
+            slot.columnOwner = std::make_unique<detail::ColumnStore<T>>(maxRows);
+            slot.columns.store(slot.columnOwner.get(), std::memory_order_release);
+        }
+
+        /**
+         * @brief Subscribe a column handler to a columnar event type.
+         * @tparam T The event data type, with columnar buffering enabled by enableColumnar().
+         * @param handler The handler function taking `const ColumnView<T> &`, returning either void or HandlerResult.
+         * @return The handler ID, or 0 if columnar buffering is not enabled for T.
+         * @details The handler receives all rows buffered since the previous dispatch as one span per field.
+         * Events published in sync mode are delivered as a view of one row.
+         */
+        template <ColumnarType T, typename Handler>
+            requires std::is_invocable_v<Handler &, const ColumnView<T> &>
+        HandlerId subscribeColumns(Handler &&handler) {
+            auto columnHandler = std::make_shared<ColumnEventHandler<T>>(std::forward<Handler>(handler));
+            auto handlerId = nextHandlerId.fetch_add(1);
+            columnHandler->id = handlerId;
+
+            {
+                std::unique_lock<std::shared_mutex> lock(handlerMtx);
+                auto it = handlerSlots.find(detail::typeOrdinal<T>());
+                if (it == handlerSlots.end() || !it->second->columnOwner)
+                    return 0;
+
+                handlerIndex.emplace(handlerId,
+                                     detail::HandlerRecord{detail::typeOrdinal<T>(), detail::HandlerKind::Column, &columnHandler->active});
+                auto &store = static_cast<detail::ColumnStore<T> &>(*it->second->columnOwner);
+                auto columnHandlers = store.owner ? std::make_shared<ColumnHandlerList<T>>(*store.owner) : std::make_shared<ColumnHandlerList<T>>();
+                columnHandlers->push_back(std::move(columnHandler));
+                it->second->activeBulkHandlers.fetch_add(1, std::memory_order_release);
+                replaceColumnHandlers<T>(store, std::move(columnHandlers));
+            }
+            reclaimDomain.reclaim();
+
+            return handlerId;
         }
 
         /**
          * @brief Unsubscribe a handler from an event type.
          * @tparam T The event data type.
          * @param handlerId The handler ID.
-         * @return True if unsubscribed, false otherwise.
+         * @return True if unsubscribed, false if no handler of T has this ID.
          */
         template <typename T>
         bool unsubscribe(HandlerId handlerId) {
-            std::unique_lock<std::shared_mutex> lock(eventMtx);
-            auto typeIndex = std::type_index(typeid(T));
-            auto it = eventHandlers.find(typeIndex);
-            if (it == eventHandlers.end())
-                return false;
+            bool removed;
+            {
+                std::unique_lock<std::shared_mutex> lock(handlerMtx);
+                removeExpiredHandlers();
+                removed = removeHandler(handlerId, detail::typeOrdinal<T>());
+            }
+            reclaimDomain.reclaim();
+            return removed;
+        }
+
+        /**
+         * @brief Unsubscribe a handler of any kind and event type.
+         * @param handlerId The handler ID, as returned by subscribe(), subscribeBatch() or subscribeColumns().
+         * @return True if unsubscribed, false if no handler has this ID.
+         * @details The handler stops receiving events immediately, an invocation already in progress
+         * on another thread completes. Amortized O(1): removed handlers are dropped from the dispatch
+         * lists once they make up half of them.
+         */
+        bool unsubscribe(HandlerId handlerId) {
+            bool removed;
+            {
+                std::unique_lock<std::shared_mutex> lock(handlerMtx);
+                removeExpiredHandlers();
+                removed = removeHandler(handlerId, std::numeric_limits<std::size_t>::max());
+            }
+            reclaimDomain.reclaim();
+            return removed;
+        }
 
-            auto &handlers = it->second;
-            auto removeIt = std::remove_if(handlers.begin(), handlers.end(),
-                                           [handlerId](const std::shared_ptr<BaseEventHandler> &handler) {
-                                               return handler->id == handlerId;
-                                           });
+        /**
+         * @brief Subscribe to an event type for the lifetime of the returned handle.
+         * @tparam T The event data type.
+         * @param handler The handler function, as for subscribe().
+         * @param minPriority The minimum priority to handle.
+         * @param handlerPriority The order of this handler, higher priority handlers run first.
+         * @return A handle that unsubscribes the handler when destroyed or reset.
+         */
+        template <typename T, typename Handler>
+            requires(std::is_invocable_v<Handler &, const T &> || std::is_invocable_v<Handler &, std::shared_ptr<const T>>)
+        Subscription subscribeScoped(Handler &&handler,
+                                     neko::Priority minPriority = neko::Priority::Low,
+                                     neko::Priority handlerPriority = neko::Priority::Normal);
 
-            if (removeIt != handlers.end()) {
-                handlers.erase(removeIt, handlers.end());
-                return true;
+        /**
+         * @brief Register an event type ahead of time.
+         * @tparam T The event data type.
+         * @details Types registered before freeze() are dispatched through the frozen dense table.
+         * Registering also resolves the handlers inherited from the bases declared in EventBases<T>.
+         */
+        template <typename T>
+        void registerEventType() {
+            std::unique_lock<std::shared_mutex> lock(handlerMtx);
+            registerType<T>();
+        }
+
+        /**
+         * @brief Freeze the set of registered event types.
+         * @details Converts the registry into a dense array indexed by type ordinal, so dispatch
+         * looks up handlers without locks. Subscribing and unsubscribing stay possible and replace
+         * handler lists copy-on-write; types first seen after freezing take a slower, locked lookup.
+         */
+        void freeze() {
+            std::unique_lock<std::shared_mutex> lock(handlerMtx);
+            if (registryFrozen.load())
+                return;
+
+            std::size_t size = 0;
+            for (const auto &[ordinal, slot] : handlerSlots) {
+                size = std::max(size, ordinal + 1);
             }
-            return false;
+            frozenSlots.assign(size, nullptr);
+            for (const auto &[ordinal, slot] : handlerSlots) {
+                frozenSlots[ordinal] = slot.get();
+            }
+            registryFrozen.store(true, std::memory_order_release);
         }
 
         /**
@@ -573,6 +4141,9 @@ namespace neko::event {
          */
         template <typename T>
         void publish(const T &eventData) {
+            prepareType<T>();
+            if (publishColumns(eventData))
+                return;
             auto event = std::make_shared<Event<T>>(eventData);
             publishEvent(event);
         }
@@ -584,7 +4155,10 @@ namespace neko::event {
          */
         template <typename T>
         void publish(T &&eventData) {
-            auto event = std::make_shared<Event<T>>(std::forward<T>(eventData));
+            prepareType<std::decay_t<T>>();
+            if (publishColumns<std::decay_t<T>>(eventData))
+                return;
+            auto event = std::make_shared<Event<std::decay_t<T>>>(std::forward<T>(eventData));
             publishEvent(event);
         }
 
@@ -599,8 +4173,124 @@ namespace neko::event {
         void publish(const T &eventData, neko::Priority priority, neko::SyncMode mode = neko::SyncMode::Async) {
             updateStats(true);
 
+            prepareType<T>();
+            if (mode == neko::SyncMode::Async && publishColumns(eventData))
+                return;
+            auto event = std::make_shared<Event<T>>(eventData);
+            event->priority = priority;
+            event->mode = mode;
+
+            if (mode == neko::SyncMode::Sync) {
+                processSingleEvent(event);
+                if constexpr (ColumnarType<T>) {
+                    processSingleRow(eventData);
+                }
+            } else {
+                publishEvent(event);
+            }
+        }
+
+        /**
+         * @brief Publish an event to a dispatch phase.
+         * @tparam T The event data type.
+         * @param phase The phase, dispatched by pump(phase).
+         * @param eventData The event data.
+         * @param priority The event priority.
+         * @note Phase events bypass the event queue and its limits; they are only dispatched by pump(phase).
+         */
+        template <typename T>
+        void publishToPhase(Phase phase, const T &eventData, neko::Priority priority = neko::Priority::Normal) {
+            updateStats(true);
+
+            prepareType<T>();
             auto event = std::make_shared<Event<T>>(eventData);
             event->priority = priority;
+            stamp(*event);
+            if (!admitCascade(event))
+                return;
+
+            std::lock_guard<std::mutex> lock(phaseMtx);
+            phaseQueues[phase].active.push_back(std::move(event));
+        }
+
+        /**
+         * @brief Publish an event sharing an immutable payload.
+         * @tparam T The event data type.
+         * @param payload The payload, must not be null.
+         * @param priority The event priority.
+         * @param mode The processing mode.
+         * @note The payload is never copied; all handlers, forwarded events and deferred tasks
+         * reference the same object, which is released with the last reference.
+         */
+        template <typename T>
+        void publishShared(std::shared_ptr<const T> payload, neko::Priority priority = neko::Priority::Normal, neko::SyncMode mode = neko::SyncMode::Async) {
+            updateStats(true);
+
+            prepareType<T>();
+            auto event = std::make_shared<SharedEvent<T>>(std::move(payload));
+            event->priority = priority;
+            event->mode = mode;
+
+            if (mode == neko::SyncMode::Sync) {
+                processSingleEvent(event);
+            } else {
+                publishEvent(event);
+            }
+        }
+
+        /**
+         * @brief Check whether any handler is subscribed to an event type.
+         * @tparam T The event data type.
+         * @return True if a per-event, batch or column handler would receive events of type T,
+         * including handlers subscribed to a base type.
+         * @details Reads the active handler counts of T and its declared bases, kept up to date on
+         * subscribe, unsubscribe and expiry. Never registers T and never takes a lock, whether or not
+         * the registry is frozen.
+         * @note The answer may be stale by the time an event is dispatched.
+         */
+        template <typename T>
+        bool hasSubscribers() const {
+            auto *slot = slotDirectory.find(detail::typeOrdinal<T>());
+            if (slot && (slot->activeHandlers.load(std::memory_order_acquire) > 0 ||
+                         slot->activeBulkHandlers.load(std::memory_order_acquire) > 0))
+                return true;
+            if constexpr (detail::hasEventBases<T>) {
+                return hasBaseSubscribers(typename EventBases<T>::type{});
+            }
+            return false;
+        }
+
+        /**
+         * @brief Publish an event whose payload is only built if a handler reads it.
+         * @tparam T The event data type.
+         * @param factory Callable returning the payload.
+         * @param priority The event priority.
+         * @param mode The processing mode.
+         * @return False if nothing is subscribed to T, in which case nothing is published.
+         * @details The factory runs at most once, on the thread dispatching the event, when the first
+         * handler passing the priority check reads the payload. Events no handler reads, e.g. all handlers
+         * unsubscribed before dispatch or require a higher priority, never build their payload.
+         * @note Columnar types with buffering enabled build the payload immediately since it is
+         * appended to the column arrays on publish.
+         */
+        template <typename T, typename Factory>
+            requires std::is_convertible_v<std::invoke_result_t<Factory &>, T>
+        bool publishLazy(Factory &&factory, neko::Priority priority = neko::Priority::Normal, neko::SyncMode mode = neko::SyncMode::Async) {
+            if (!hasSubscribers<T>())
+                return false;
+            prepareType<T>();
+
+            if constexpr (ColumnarType<T>) {
+                auto *slot = findSlot(detail::typeOrdinal<T>());
+                if (slot && slot->columns.load(std::memory_order_acquire)) {
+                    publish<T>(T(factory()), priority, mode);
+                    return true;
+                }
+            }
+
+            updateStats(true);
+            auto event = std::make_shared<LazyEvent<T, std::decay_t<Factory>>>(std::forward<Factory>(factory));
+            event->priority = priority;
             event->mode = mode;
 
             if (mode == neko::SyncMode::Sync) {
@@ -608,6 +4298,21 @@ namespace neko::event {
             } else {
                 publishEvent(event);
             }
+            return true;
+        }
+
+        /**
+         * @brief Publish an event sharing an immutable payload after a delay.
+         * @tparam T The event data type.
+         * @param ms Delay in milliseconds.
+         * @param payload The payload, must not be null.
+         * @return The scheduled task ID.
+         */
+        template <typename T>
+        EventId publishSharedAfter(neko::uint64 ms, std::shared_ptr<const T> payload) {
+            return scheduleTask(ms, [this, payload = std::move(payload)]() {
+                publishShared(payload);
+            });
         }
 
         /**
@@ -648,28 +4353,110 @@ namespace neko::event {
          */
         template <typename T>
         bool addFilter(HandlerId handlerId, std::unique_ptr<EventFilter<T>> filter) {
-            std::shared_lock<std::shared_mutex> readLock(eventMtx);
-            auto typeIndex = std::type_index(typeid(T));
-            auto it = eventHandlers.find(typeIndex);
-            if (it == eventHandlers.end())
+            std::shared_lock<std::shared_mutex> readLock(handlerMtx);
+            auto it = handlerSlots.find(detail::typeOrdinal<T>());
+            if (it == handlerSlots.end())
                 return false;
 
             // Find the target handler
-            std::shared_ptr<EventHandler<T>> targetHandler = nullptr;
-            for (auto &handler : it->second) {
+            std::shared_ptr<FilteredEventHandler<T>> targetHandler = nullptr;
+            for (auto &handler : it->second->own) {
                 if (handler->id == handlerId) {
-                    targetHandler = std::static_pointer_cast<EventHandler<T>>(handler);
+                    targetHandler = std::static_pointer_cast<FilteredEventHandler<T>>(handler);
                     break;
                 }
             }
-            readLock.unlock();
+            std::shared_ptr<BatchEventHandler<T>> targetBatchHandler = nullptr;
+            if (!targetHandler && it->second->batchOwner) {
+                for (auto &handler : *it->second->batchOwner) {
+                    if (handler->id == handlerId) {
+                        targetBatchHandler = std::static_pointer_cast<BatchEventHandler<T>>(handler);
+                        break;
+                    }
+                }
+            }
+            readLock.unlock();
+
+            // addFilter to the handler , no need for event lock
+            if (targetHandler) {
+                targetHandler->addFilter(std::move(filter));
+                return true;
+            }
+            if (targetBatchHandler) {
+                targetBatchHandler->addFilter(std::move(filter));
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Add a bulk-evaluated predicate filter to an existing event handler.
+         * @tparam T The event data type.
+         * @param handlerId The handler ID.
+         * @param predicate The predicate, e.g. field(&Tick::price) > 100.0.
+         * @return True if added, false otherwise.
+         * @note Batch handlers evaluate the predicate over the whole batch using SIMD where available.
+         */
+        template <typename T, typename Predicate>
+            requires std::is_base_of_v<BatchFilter<T>, Predicate>
+        bool addFilter(HandlerId handlerId, Predicate predicate) {
+            return addFilter<T>(handlerId, std::unique_ptr<EventFilter<T>>(std::make_unique<Predicate>(std::move(predicate))));
+        }
+
+        /**
+         * @brief Get a copy of the dead-letter queue.
+         * @return The dead letters, oldest first.
+         */
+        std::vector<DeadLetter> getDeadLetters() const {
+            std::lock_guard<std::mutex> lock(deadLetterMtx);
+            return {deadLetters.begin(), deadLetters.end()};
+        }
+
+        /**
+         * @brief Remove and return all entries of the dead-letter queue.
+         * @return The dead letters, oldest first.
+         */
+        std::vector<DeadLetter> takeDeadLetters() {
+            std::lock_guard<std::mutex> lock(deadLetterMtx);
+            std::vector<DeadLetter> result(std::make_move_iterator(deadLetters.begin()), std::make_move_iterator(deadLetters.end()));
+            deadLetters.clear();
+            return result;
+        }
+
+        /**
+         * @brief Republish dead-lettered events through the scheduler with exponential backoff.
+         * @param baseDelayMs The delay before the first retry; doubled for every previous attempt.
+         * @param maxAttempts Events retried this many times already stay in the dead-letter queue.
+         * @return The number of events scheduled for retry.
+         */
+        neko::uint64 retryDeadLetters(neko::uint64 baseDelayMs = 100, neko::uint32 maxAttempts = 3) {
+            std::vector<DeadLetter> retries;
+            {
+                std::lock_guard<std::mutex> lock(deadLetterMtx);
+                auto retryBegin = std::stable_partition(deadLetters.begin(), deadLetters.end(), [maxAttempts](const DeadLetter &letter) {
+                    return letter.attempts >= maxAttempts;
+                });
+                retries.assign(std::make_move_iterator(retryBegin), std::make_move_iterator(deadLetters.end()));
+                deadLetters.erase(retryBegin, deadLetters.end());
+            }
 
-            if (targetHandler) {
-                // addFilter to the handler , no need for event lock
-                targetHandler->addFilter(std::move(filter));
-                return true;
+            for (auto &letter : retries) {
+                auto delay = baseDelayMs << std::min<neko::uint32>(letter.attempts, 16);
+                auto event = std::move(letter.event);
+                ++event->retryCount;
+                scheduleTask(delay, [this, event]() {
+                    publishEvent(event);
+                });
             }
-            return false;
+            return retries.size();
+        }
+
+        /**
+         * @brief Discard all entries of the dead-letter queue.
+         */
+        void clearDeadLetters() {
+            std::lock_guard<std::mutex> lock(deadLetterMtx);
+            deadLetters.clear();
         }
 
         // === Event methods End ===
@@ -678,7 +4465,7 @@ namespace neko::event {
 
         /**
          * @brief Schedule a task at a specific time.
-         * @param t The execution time.
+         * @param t The execution time, on the scheduler clock (see setClock()).
          * @param cb The callback function.
          * @param priority The priority.
          * @return The scheduled task ID.
@@ -695,57 +4482,30 @@ namespace neko::event {
          * @return The scheduled task ID.
          */
         EventId scheduleTask(neko::uint64 ms, std::function<void()> cb, neko::Priority priority = neko::Priority::Normal) {
-            return scheduleTaskInternal(std::chrono::steady_clock::now() + std::chrono::milliseconds(ms), std::move(cb), priority);
+            return scheduleTaskInternal(clock->now() + std::chrono::milliseconds(ms), std::move(cb), priority);
         }
 
         /**
          * @brief Schedule a repeating task.
-         * @param intervalMs The interval in milliseconds.
+         * @param intervalMs The interval in milliseconds, 0 is treated as 1.
          * @param cb The callback function.
          * @param priority The priority.
          * @return The scheduled task ID.
          */
         EventId scheduleRepeating(neko::uint64 intervalMs, std::function<void()> cb, neko::Priority priority = neko::Priority::Normal) {
             EventId id = nextTaskId.fetch_add(1);
-            auto interval = std::chrono::milliseconds(intervalMs);
-
-            // Use shared_ptr to safely capture data in callback
-            auto sharedCb = std::make_shared<std::function<void()>>(std::move(cb));
-
-            std::function<void()> repeatWrapper = [this, sharedCb, interval, id, priority]() {
-                (*sharedCb)();
-                // Reschedule (if not cancelled)
-                {
-                    std::lock_guard<std::mutex> lock(taskMtx);
-                    if (cancelledTasks.find(id) == cancelledTasks.end()) {
-                        ScheduledTask task{std::chrono::steady_clock::now() + interval,
-                                           [this, sharedCb, interval, id, priority]() {
-                                               (*sharedCb)();
-                                               std::lock_guard<std::mutex> lock(taskMtx);
-                                               if (cancelledTasks.find(id) == cancelledTasks.end()) {
-                                                   ScheduledTask nextTask{std::chrono::steady_clock::now() + interval,
-                                                                          [this, sharedCb, interval, id, priority]() { /* recursive */ }, id, priority};
-                                                   nextTask.repeating = true;
-                                                   nextTask.interval = interval;
-                                                   taskQueue.push(std::move(nextTask));
-                                               }
-                                           },
-                                           id, priority};
-                        task.repeating = true;
-                        task.interval = interval;
-                        taskQueue.push(std::move(task));
-                    }
-                }
-            };
+            auto interval = std::chrono::milliseconds(std::max<neko::uint64>(intervalMs, 1));
 
             {
                 std::lock_guard<std::mutex> lock(taskMtx);
-                ScheduledTask task{std::chrono::steady_clock::now() + interval, std::move(repeatWrapper), id, priority};
+                // Rescheduled by processScheduledTasks() after each run until cancelled
+                ScheduledTask task{clock->now() + interval, std::move(cb), id, priority};
                 task.repeating = true;
                 task.interval = interval;
                 taskQueue.push(std::move(task));
             }
             taskCv.notify_one();
+            notifyLoop();
             return id;
         }
 
@@ -782,20 +4542,277 @@ namespace neko::event {
 
         // === Task methods End ===
 
+        // === Stream operator methods ===
+
+        /**
+         * @brief Deliver the events of a type over time windows.
+         * @tparam T The event data type, must be copyable.
+         * @param size The length of a window.
+         * @param slide The time between two windows, equal to size (or 0) for tumbling windows
+         * and shorter for sliding windows.
+         * @param handler The handler function taking `std::span<const T>`, returning either void or HandlerResult.
+         * @return The ID of the handler feeding the window, unsubscribe it to stop the windows.
+         * @details Every slide, the handler receives the events that arrived within the last size,
+         * possibly none; a window includes its start and excludes its end. Arrival times come from the scheduler clock. Events are kept in a ring buffer
+         * and copied into a reused buffer per window, so feeding a window does not allocate.
+         */
+        template <typename T, typename Handler>
+            requires(std::copyable<T> && std::is_invocable_v<Handler &, std::span<const T>>)
+        HandlerId subscribeWindow(std::chrono::nanoseconds size, std::chrono::nanoseconds slide, Handler &&handler) {
+            if (slide <= std::chrono::nanoseconds::zero() || slide > size) {
+                slide = size;
+            }
+            if (size <= std::chrono::nanoseconds::zero())
+                return 0;
+
+            struct State {
+                std::mutex mtx;
+                detail::EventRing<T> ring;
+                std::vector<T> window;
+                std::decay_t<Handler> callback;
+                std::weak_ptr<BaseEventHandler> feed;
+            };
+            auto state = std::shared_ptr<State>(new State{{}, {}, {}, std::forward<Handler>(handler), {}});
+
+            auto feed = std::make_shared<EventHandler<T>>([this, state](const T &data) {
+                std::lock_guard<std::mutex> lock(state->mtx);
+                state->ring.push(now(), data);
+            });
+            state->feed = feed;
+            auto handlerId = addHandler<T>(std::move(feed), neko::Priority::Low, neko::Priority::Normal);
+
+            auto interval = std::chrono::duration_cast<TimePoint::duration>(slide);
+            auto length = std::chrono::duration_cast<TimePoint::duration>(size);
+            scheduleOperatorTick(state, now() + interval, [this, interval, length](State &current, TimePoint due) -> std::optional<TimePoint> {
+                {
+                    std::lock_guard<std::mutex> lock(current.mtx);
+                    current.ring.dropBefore(due - length);
+                    current.window.clear();
+                    current.ring.copyBefore(current.window, due);
+                }
+                // Ticks of one operator never overlap, so the window buffer is not shared
+                countOperatorResult(detail::invokeCallback(current.callback, std::span<const T>(current.window)));
+                return due + interval;
+            });
+            return handlerId;
+        }
+
+        /**
+         * @brief Deliver the events of a type in buffers of a maximum count or age.
+         * @tparam T The event data type, must be copyable.
+         * @param count Deliver once this many events are buffered, 0 for no count limit.
+         * @param maxAge Deliver once the oldest buffered event is this old, 0 for no age limit.
+         * @param handler The handler function taking `std::span<const T>`, returning either void or HandlerResult.
+         * @return The ID of the handler feeding the buffer, or 0 if neither limit is set.
+         * @note Events still buffered when the handler is unsubscribed are dropped.
+         */
+        template <typename T, typename Handler>
+            requires(std::copyable<T> && std::is_invocable_v<Handler &, std::span<const T>>)
+        HandlerId subscribeBuffered(std::size_t count, std::chrono::nanoseconds maxAge, Handler &&handler) {
+            if (count == 0 && maxAge <= std::chrono::nanoseconds::zero())
+                return 0;
+
+            struct State {
+                std::mutex mtx;
+                std::vector<T> items;
+                std::vector<T> spare;
+                neko::uint64 generation = 0; // Incremented per delivery, so age timers of delivered buffers do nothing
+                std::decay_t<Handler> callback;
+                std::weak_ptr<BaseEventHandler> feed;
+
+                // Swap the full buffer out, the caller delivers it and hands it back with recycle()
+                std::vector<T> take() {
+                    std::vector<T> taken = std::move(spare);
+                    taken.swap(items);
+                    ++generation;
+                    return taken;
+                }
+
+                void recycle(std::vector<T> &&taken) {
+                    taken.clear();
+                    std::lock_guard<std::mutex> lock(mtx);
+                    spare = std::move(taken);
+                }
+            };
+            auto state = std::shared_ptr<State>(new State{{}, {}, {}, 0, std::forward<Handler>(handler), {}});
+            auto age = std::chrono::duration_cast<TimePoint::duration>(maxAge);
+
+            auto onAge = [this](State &current, TimePoint) -> std::optional<TimePoint> {
+                std::vector<T> taken;
+                {
+                    std::lock_guard<std::mutex> lock(current.mtx);
+                    if (current.items.empty())
+                        return std::nullopt;
+                    taken = current.take();
+                }
+                countOperatorResult(detail::invokeCallback(current.callback, std::span<const T>(taken)));
+                current.recycle(std::move(taken));
+                return std::nullopt;
+            };
+
+            auto feed = std::make_shared<EventHandler<T>>([this, state, count, age, onAge](const T &data) -> HandlerResult {
+                std::vector<T> taken;
+                {
+                    std::lock_guard<std::mutex> lock(state->mtx);
+                    if (state->items.empty() && age > TimePoint::duration::zero()) {
+                        // One timer per buffer, it only delivers if the buffer was not delivered by count first
+                        auto generation = state->generation;
+                        scheduleOperatorTick(state, now() + age, [onAge, generation](State &current, TimePoint due) -> std::optional<TimePoint> {
+                            {
+                                std::lock_guard<std::mutex> lock(current.mtx);
+                                if (current.generation != generation)
+                                    return std::nullopt;
+                            }
+                            return onAge(current, due);
+                        });
+                    }
+                    state->items.push_back(data);
+                    if (count == 0 || state->items.size() < count)
+                        return HandlerResult::ok();
+                    taken = state->take();
+                }
+                auto result = detail::invokeCallback(state->callback, std::span<const T>(taken));
+                state->recycle(std::move(taken));
+                return result;
+            });
+            state->feed = feed;
+            return addHandler<T>(std::move(feed), neko::Priority::Low, neko::Priority::Normal);
+        }
+
+        /**
+         * @brief Deliver the last event of a burst once no event of the type arrived for a quiet period.
+         * @tparam T The event data type, must be copyable.
+         * @param quiet The quiet period.
+         * @param handler The handler function taking `const T &`, returning either void or HandlerResult.
+         * @return The ID of the handler feeding the operator.
+         * @details A single timer runs per burst and is pushed back while events keep arriving.
+         */
+        template <typename T, typename Handler>
+            requires(std::copyable<T> && std::is_invocable_v<Handler &, const T &>)
+        HandlerId subscribeDebounced(std::chrono::nanoseconds quiet, Handler &&handler) {
+            struct State {
+                std::mutex mtx;
+                std::optional<T> latest;
+                TimePoint deadline{};
+                bool armed = false;
+                std::decay_t<Handler> callback;
+                std::weak_ptr<BaseEventHandler> feed;
+            };
+            auto state = std::shared_ptr<State>(new State{{}, {}, {}, false, std::forward<Handler>(handler), {}});
+            auto period = std::chrono::duration_cast<TimePoint::duration>(quiet);
+
+            auto onQuiet = [this](State &current, TimePoint) -> std::optional<TimePoint> {
+                std::optional<T> value;
+                {
+                    std::lock_guard<std::mutex> lock(current.mtx);
+                    if (now() < current.deadline)
+                        return current.deadline;
+                    current.armed = false;
+                    value.swap(current.latest);
+                }
+                if (value) {
+                    countOperatorResult(detail::invokeCallback(current.callback, *value));
+                }
+                return std::nullopt;
+            };
+
+            auto feed = std::make_shared<EventHandler<T>>([this, state, period, onQuiet](const T &data) {
+                std::lock_guard<std::mutex> lock(state->mtx);
+                state->latest = data;
+                state->deadline = now() + period;
+                if (!state->armed) {
+                    state->armed = true;
+                    scheduleOperatorTick(state, state->deadline, onQuiet);
+                }
+            });
+            state->feed = feed;
+            return addHandler<T>(std::move(feed), neko::Priority::Low, neko::Priority::Normal);
+        }
+
+        /**
+         * @brief Deliver at most one event of a type per interval, the first one.
+         * @tparam T The event data type.
+         * @param interval The interval.
+         * @param handler The handler function taking `const T &`, returning either void or HandlerResult.
+         * @return The handler ID.
+         * @details Runs within dispatch without timers or locks; suppressed events are reported as filtered.
+         */
+        template <typename T, typename Handler>
+            requires std::is_invocable_v<Handler &, const T &>
+        HandlerId subscribeThrottled(std::chrono::nanoseconds interval, Handler &&handler) {
+            auto period = std::chrono::duration_cast<TimePoint::duration>(interval);
+            auto next = std::make_shared<std::atomic<TimePoint::rep>>(std::numeric_limits<TimePoint::rep>::min());
+            return subscribe<T>([this, period, next, callback = std::forward<Handler>(handler)](const T &data) mutable -> HandlerResult {
+                auto current = now();
+                auto allowed = next->load(std::memory_order_relaxed);
+                if (current.time_since_epoch().count() < allowed ||
+                    !next->compare_exchange_strong(allowed, (current + period).time_since_epoch().count())) {
+                    return HandlerResult::filtered();
+                }
+                return detail::invokeCallback(callback, data);
+            });
+        }
+
+        /**
+         * @brief Deliver the latest event of a type once per interval, if one arrived since the previous sample.
+         * @tparam T The event data type, must be copyable.
+         * @param interval The sampling interval.
+         * @param handler The handler function taking `const T &`, returning either void or HandlerResult.
+         * @return The ID of the handler feeding the sampler.
+         */
+        template <typename T, typename Handler>
+            requires(std::copyable<T> && std::is_invocable_v<Handler &, const T &>)
+        HandlerId subscribeSampled(std::chrono::nanoseconds interval, Handler &&handler) {
+            struct State {
+                std::mutex mtx;
+                std::optional<T> latest;
+                std::decay_t<Handler> callback;
+                std::weak_ptr<BaseEventHandler> feed;
+            };
+            auto state = std::shared_ptr<State>(new State{{}, {}, std::forward<Handler>(handler), {}});
+
+            auto feed = std::make_shared<EventHandler<T>>([state](const T &data) {
+                std::lock_guard<std::mutex> lock(state->mtx);
+                state->latest = data;
+            });
+            state->feed = feed;
+            auto handlerId = addHandler<T>(std::move(feed), neko::Priority::Low, neko::Priority::Normal);
+
+            auto period = std::chrono::duration_cast<TimePoint::duration>(interval);
+            scheduleOperatorTick(state, now() + period, [this, period](State &current, TimePoint due) -> std::optional<TimePoint> {
+                std::optional<T> value;
+                {
+                    std::lock_guard<std::mutex> lock(current.mtx);
+                    value.swap(current.latest);
+                }
+                if (value) {
+                    countOperatorResult(detail::invokeCallback(current.callback, *value));
+                }
+                return due + period;
+            });
+            return handlerId;
+        }
+
+        // === Stream operator methods End ===
+
         // === Event Loop Control ===
 
         /**
-         * @brief Run the main event loop.
+         * @brief Run the main event loop until stopLoop() is called.
+         * @details Several threads may call run() at the same time to process events as a pool of
+         * workers; handlers then run concurrently and events of different threads are not ordered.
+         * The last worker to return finishes the shutdown.
          */
         void run() {
             constexpr auto cleanupInterval = std::chrono::seconds(2);
             constexpr auto maxWaitTime = std::chrono::milliseconds(100);
 
+            enterRun();
             auto lastCleanup = std::chrono::steady_clock::now();
 
             while (!stop.load()) {
 
-                bool hasEvents = processEvents();
+                bool hasEvents = processEvents() > 0;
 
                 auto nextTaskTime = processScheduledTasks();
 
@@ -812,24 +4829,172 @@ namespace neko::event {
                     waitForWork(nextTaskTime, maxWaitTime);
                 }
             }
+
+            exitRun();
         }
 
         /**
          * @brief Stop the event loop.
+         * @param mode What happens to queued work, see ShutdownMode.
+         * @param drainTimeout The maximum real time spent draining, 0 for no limit.
+         * @details The loop finishes the current handler, drains as requested and discards the
+         * remaining events, counting them in discardedEvents. Scheduled tasks that are not due stay
+         * scheduled. The stop stays in effect until restart(): run() and runFor() return at once, so a
+         * worker that starts after the others have stopped cannot keep the loop running.
          */
-        void stopLoop() {
+        void stopLoop(ShutdownMode mode = ShutdownMode::Immediate, std::chrono::milliseconds drainTimeout = std::chrono::milliseconds(0)) {
+            {
+                std::lock_guard<std::mutex> lock(loopMtx);
+                shutdownPending = true;
+                shutdownMode = mode;
+                if (drainTimeout.count() > 0) {
+                    shutdownDeadline = std::chrono::steady_clock::now() + drainTimeout;
+                } else {
+                    shutdownDeadline.reset();
+                }
+            }
             stop.store(true);
 
             taskCv.notify_all();
             eventCv.notify_all();
-            loopCv.notify_all();
+            notifyLoop(true);
+        }
+
+        /**
+         * @brief Allow the loop to run again after stopLoop(), keeping handlers, pools and configuration.
+         * @details Waits for the runners to return. If no runner finished the shutdown, e.g. the loop
+         * was not running when stopped, it is finished here first. Does nothing if no stop was requested.
+         */
+        void restart() {
+            std::unique_lock<std::mutex> lock(loopMtx);
+            drainedCv.wait(lock, [this]() { return activeRunners == 0 && state.load() != LoopState::Draining; });
+            if (!stop.load())
+                return;
+
+            if (shutdownPending) {
+                auto previous = state.load();
+                state.store(LoopState::Draining);
+                lock.unlock();
+                finishShutdown();
+                lock.lock();
+                state.store(previous);
+                drainedCv.notify_all();
+            }
+            stop.store(false);
         }
 
         /**
          * @brief Wake up the event loop.
          */
         void wakeUp() {
-            loopCv.notify_one();
+            notifyLoop();
+        }
+
+        /**
+         * @brief Run due scheduled tasks, then process the events queued so far.
+         * @return The number of events processed.
+         * @details For embedding the loop in an existing main loop instead of calling run().
+         * Events published while pumping are left for the next call, bounding the work per frame.
+         */
+        std::size_t pump() {
+            processScheduledTasks(std::nullopt, false);
+            std::size_t queued;
+            {
+                std::shared_lock<std::shared_mutex> lock(eventMtx);
+                queued = eventQueue.size();
+            }
+            return processEvents(queued, std::nullopt, false);
+        }
+
+        /**
+         * @brief Dispatch the events published to a phase.
+         * @param phase The phase.
+         * @return The number of events dispatched.
+         * @details Events published to the phase while it is pumped are kept for the next pump of that phase.
+         */
+        std::size_t pump(Phase phase) {
+            std::vector<std::shared_ptr<BaseEvent>> events;
+            {
+                std::lock_guard<std::mutex> lock(phaseMtx);
+                auto &queue = phaseQueues[phase];
+                events = std::move(queue.active);
+                queue.active = std::move(queue.spare);
+                queue.active.clear();
+            }
+
+            dispatchEvents(events);
+            auto dispatched = events.size();
+
+            events.clear();
+            std::lock_guard<std::mutex> lock(phaseMtx);
+            phaseQueues[phase].spare = std::move(events);
+            return dispatched;
+        }
+
+        /**
+         * @brief Process queued events until the queue is empty or the deadline is reached.
+         * @param deadline The deadline on the scheduler clock, as returned by now(); checked between events.
+         * @return The number of events processed.
+         * @note With a ManualClock the deadline is only reached if the clock is advanced while processing.
+         */
+        std::size_t processUntil(TimePoint deadline) {
+            auto schedulerClock = clock;
+            return processEvents(std::numeric_limits<std::size_t>::max(), deadline, false, schedulerClock.get());
+        }
+
+        /**
+         * @brief Process at most a number of queued events.
+         * @param maxEvents The maximum number of events.
+         * @return The number of events processed.
+         */
+        std::size_t processAtMost(std::size_t maxEvents) {
+            return processEvents(maxEvents, std::nullopt, false);
+        }
+
+        /**
+         * @brief Run due tasks and process queued events within a time budget, without waiting.
+         * @param budget The time budget, measured in real time on std::chrono::steady_clock whatever the scheduler clock.
+         * @param byPriority Whether to process higher priority events first.
+         * @return The number of events processed.
+         * @details Tasks and events left when the budget is spent stay queued for the next call.
+         */
+        std::size_t pollOnce(std::chrono::nanoseconds budget, bool byPriority = false) {
+            auto deadline = std::chrono::steady_clock::now() + budget;
+            processScheduledTasks(deadline, false);
+            if (byPriority) {
+                return processByPriority(deadline, false);
+            }
+            return processEvents(std::numeric_limits<std::size_t>::max(), deadline, false);
+        }
+
+        /**
+         * @brief Run the event loop for a duration, or until stopLoop() is called.
+         * @param duration The time to run, measured in real time on std::chrono::steady_clock whatever the scheduler clock.
+         * @param byPriority Whether to process higher priority events first.
+         * @return The number of events processed.
+         * @details Unlike pollOnce(), waits for new work while the duration is not over.
+         * Tasks and events left at the end stay queued, unless the loop was stopped.
+         */
+        std::size_t runFor(std::chrono::nanoseconds duration, bool byPriority = false) {
+            auto deadline = std::chrono::steady_clock::now() + duration;
+            std::size_t processed = 0;
+            enterRun();
+
+            while (!stop.load()) {
+                auto nextTaskTime = processScheduledTasks(deadline);
+                auto count = byPriority ? processByPriority(deadline, true)
+                                        : processEvents(std::numeric_limits<std::size_t>::max(), deadline, true);
+                processed += count;
+
+                auto now = std::chrono::steady_clock::now();
+                if (now >= deadline)
+                    break;
+                if (count == 0) {
+                    waitForWork(nextTaskTime, std::chrono::ceil<std::chrono::milliseconds>(deadline - now));
+                }
+            }
+            exitRun();
+            return processed;
         }
 
         // === Event Loop Control End ===
@@ -844,6 +5009,164 @@ namespace neko::event {
             maxQueueSize = size;
         }
 
+        /**
+         * @brief Set the maximum number of events delivered to batch handlers in one call.
+         * @param size The maximum batch size, at least 1.
+         */
+        void setMaxBatchSize(neko::uint64 size) {
+            maxBatchSize.store(std::max<neko::uint64>(size, 1));
+        }
+
+        /**
+         * @brief Set the memory budget of the event queue.
+         * @param bytes The maximum number of bytes, 0 for unlimited.
+         * @note Each event is accounted as its own size plus PayloadSize<T>::of(data).
+         */
+        void setMaxQueueBytes(neko::uint64 bytes) {
+            std::unique_lock<std::shared_mutex> lock(eventMtx);
+            maxQueueBytes = bytes;
+        }
+
+        /**
+         * @brief Set the policy applied when the event queue is full.
+         * @param policy The overflow policy.
+         */
+        void setOverflowPolicy(OverflowPolicy policy) {
+            std::unique_lock<std::shared_mutex> lock(eventMtx);
+            overflowPolicy = policy;
+        }
+
+        /**
+         * @brief Limit the rate at which events of a type are published.
+         * @tparam T The event data type.
+         * @param limit The limit, applied by the policy it names; a rate of 0 removes the limit.
+         * @details Applies to events published, retried or delivered after a delay, in both sync and
+         * async mode; rows buffered in columnar form are not limited. Tokens are accounted without locks.
+         */
+        template <typename T>
+        void setRateLimit(const RateLimit &limit) {
+            std::unique_lock<std::shared_mutex> lock(handlerMtx);
+            auto &slot = registerType<T>();
+            if (!slot.rateLimiterOwner) {
+                slot.rateLimiterOwner = std::make_unique<detail::RateLimiter>();
+                slot.rateLimiterOwner->configure(limit);
+                slot.rateLimiter.store(slot.rateLimiterOwner.get(), std::memory_order_release);
+                hasRateLimits.store(true, std::memory_order_release);
+            } else {
+                slot.rateLimiterOwner->configure(limit);
+            }
+        }
+
+        /**
+         * @brief Limit the rate at which a handler is invoked.
+         * @param handlerId The ID of a handler returned by subscribe() or its variants.
+         * @param eventsPerSecond The sustained rate, 0 or less removes the limit.
+         * @param burst The number of invocations allowed at once.
+         * @return True if set, false if no such event handler exists.
+         * @details Events beyond the limit skip this handler only, other handlers still receive them.
+         * Batch and column handlers cannot be limited.
+         */
+        bool setHandlerRateLimit(HandlerId handlerId, double eventsPerSecond, neko::uint64 burst = 1) {
+            std::unique_lock<std::shared_mutex> lock(handlerMtx);
+            auto it = handlerIndex.find(handlerId);
+            if (it == handlerIndex.end() || it->second.kind != detail::HandlerKind::Event)
+                return false;
+
+            for (const auto &handler : handlerSlots.at(it->second.typeOrdinal)->own) {
+                if (handler->id != handlerId)
+                    continue;
+                RateLimit limit{eventsPerSecond, burst};
+                if (!handler->rateLimiterOwner) {
+                    handler->rateLimiterOwner = std::make_unique<detail::RateLimiter>();
+                    handler->rateLimiterOwner->configure(limit);
+                    handler->rateLimiter.store(handler->rateLimiterOwner.get(), std::memory_order_release);
+                } else {
+                    handler->rateLimiterOwner->configure(limit);
+                }
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Set the capacity of the dead-letter queue.
+         * @param size The maximum number of entries, 0 disables the dead-letter queue.
+         * @note When full, the oldest entry is evicted.
+         */
+        void setDeadLetterQueueSize(neko::uint64 size) {
+            deadLetterCapacity.store(size);
+            std::lock_guard<std::mutex> lock(deadLetterMtx);
+            while (deadLetters.size() > size) {
+                deadLetters.pop_front();
+            }
+        }
+
+        /**
+         * @brief Set the maximum cascade depth.
+         * @param depth The maximum number of ancestors of an event published from a handler, 0 for unlimited.
+         * @note Deeper events are dropped, counted in cascadeLimitedEvents and dead-lettered with reason Cascade.
+         */
+        void setMaxCascadeDepth(neko::uint32 depth) {
+            maxCascadeDepth.store(depth);
+        }
+
+        /**
+         * @brief Enable or disable detection of type cycles in event cascades.
+         * @param enable True to record which event types publish which, reporting cycles in cascadeCycles.
+         * @note Each cycle is reported once, when the edge closing it is first seen.
+         */
+        void enableCycleDetection(bool enable) {
+            cycleDetection.store(enable);
+        }
+
+        /**
+         * @brief Enable or disable dead-lettering of events no handler accepted.
+         * @param enable True to capture filtered and unhandled events.
+         */
+        void enableDeadLetterFiltered(bool enable) {
+            deadLetterFiltered.store(enable);
+        }
+
+        /**
+         * @brief Replace the clock of the task scheduler.
+         * @param newClock The clock, e.g. a ManualClock for deterministic simulation.
+         * @note Set the clock before scheduling tasks; it must not be replaced while the loop runs.
+         * Pending task times are interpreted on the new clock.
+         */
+        void setClock(std::shared_ptr<Clock> newClock) {
+            std::lock_guard<std::mutex> lock(taskMtx);
+            clock = std::move(newClock);
+        }
+
+        /**
+         * @brief Advance a manual scheduler clock and wake up the loop.
+         * @param duration The time to add.
+         * @return True if advanced, false if the scheduler does not use a ManualClock.
+         * @note Due tasks run on the next iteration of the loop, or on the next pump() or pollOnce().
+         */
+        bool advanceTime(TimePoint::duration duration) {
+            auto *manualClock = dynamic_cast<ManualClock *>(clock.get());
+            if (!manualClock)
+                return false;
+            manualClock->advance(duration);
+            notifyLoop();
+            return true;
+        }
+
+        /**
+         * @brief Set the source of event timestamps and processing-time statistics.
+         * @param source The source, TimestampSource::None skips both.
+         * @note Selecting TimestampSource::Tsc calibrates the counter once per process, taking about 5 ms.
+         */
+        void setTimestampSource(TimestampSource source) {
+#if defined(NEKO_EVENT_HAS_TSC)
+            if (source == TimestampSource::Tsc) {
+                detail::tscCalibration();
+            }
+#endif
+            timestampSource.store(source);
+        }
+
         /**
          * @brief Enable or disable statistics collection.
          * @param enable True to enable, false to disable.
@@ -872,12 +5195,55 @@ namespace neko::event {
 
         // ==== Information methods ====
 
+        /**
+         * @brief Get the current time of the scheduler clock.
+         * @return The current time.
+         */
+        TimePoint now() const {
+            return clock->now();
+        }
+
+        /**
+         * @brief Get the event being dispatched on the calling thread.
+         * @return The event, or nullptr outside of a handler.
+         * @details Use it in handlers to log the event ID or its causal chain (parentId, rootId).
+         * Events published from a handler take the current event as their parent.
+         */
+        static const BaseEvent *currentEvent() {
+            return detail::currentDispatch();
+        }
+
         /**
          * @brief Check if the event loop is running.
-         * @return True if running, false otherwise.
+         * @return True if a thread is running the loop and no stop was requested, false otherwise.
          */
         bool isRunning() const {
-            return !stop.load();
+            return state.load() == LoopState::Running && !stop.load();
+        }
+
+        /**
+         * @brief Get the lifecycle state of the event loop.
+         * @return The state.
+         */
+        LoopState getState() const {
+            return state.load();
+        }
+
+        /**
+         * @brief Get the number of threads currently running the loop.
+         * @return The number of threads inside run() or runFor().
+         */
+        neko::uint32 getRunnerCount() const {
+            std::lock_guard<std::mutex> lock(loopMtx);
+            return activeRunners;
+        }
+
+        /**
+         * @brief Check if the handler registry is frozen.
+         * @return True if freeze() was called.
+         */
+        bool isFrozen() const {
+            return registryFrozen.load();
         }
 
         /**
@@ -892,6 +5258,9 @@ namespace neko::event {
         struct QueueSizes {
             neko::uint64 eventQueueSize;
             neko::uint64 taskQueueSize;
+            neko::uint64 eventQueueBytes;
+            neko::uint64 deadLetterQueueSize;
+            neko::uint64 phaseQueueSize; // Events waiting in all phases
         };
 
         /**
@@ -901,11 +5270,101 @@ namespace neko::event {
         QueueSizes getQueueSizes() const {
             std::shared_lock<std::shared_mutex> eventLock(eventMtx);
             std::lock_guard<std::mutex> taskLock(taskMtx);
-            return {eventQueue.size(), taskQueue.size()};
+            std::lock_guard<std::mutex> deadLetterLock(deadLetterMtx);
+            std::lock_guard<std::mutex> phaseLock(phaseMtx);
+            neko::uint64 phaseQueueSize = 0;
+            for (const auto &[phase, queue] : phaseQueues) {
+                phaseQueueSize += queue.active.size();
+            }
+            return {eventQueue.size(), taskQueue.size(), eventQueueBytes, deadLetters.size(), phaseQueueSize};
         }
 
         // === Information methods End ===
 
     }; // EventLoop
 
+    /**
+     * @class Subscription
+     * @brief Move-only handle that unsubscribes its handler when destroyed.
+     * @details Destroying the handle after the loop is safe and does nothing. The handle must not
+     * be destroyed concurrently with the loop itself.
+     */
+    class Subscription {
+    private:
+        std::weak_ptr<EventLoop *> loop;
+        HandlerId handlerId = 0;
+
+    public:
+        Subscription() = default;
+
+        /**
+         * @brief Take ownership of a subscribed handler.
+         * @param eventLoop The lifetime token of the loop the handler is subscribed to.
+         * @param id The handler ID.
+         */
+        Subscription(std::weak_ptr<EventLoop *> eventLoop, HandlerId id) : loop(std::move(eventLoop)), handlerId(id) {}
+
+        ~Subscription() {
+            reset();
+        }
+
+        Subscription(Subscription &&other) noexcept
+            : loop(std::move(other.loop)), handlerId(std::exchange(other.handlerId, 0)) {}
+
+        Subscription &operator=(Subscription &&other) noexcept {
+            if (this != &other) {
+                reset();
+                loop = std::move(other.loop);
+                handlerId = std::exchange(other.handlerId, 0);
+            }
+            return *this;
+        }
+
+        Subscription(const Subscription &) = delete;
+        Subscription &operator=(const Subscription &) = delete;
+
+        /**
+         * @brief Get the handler ID.
+         * @return The handler ID, or 0 if the handle is empty.
+         */
+        HandlerId id() const {
+            return handlerId;
+        }
+
+        /**
+         * @brief Check if the handle still owns a handler.
+         */
+        explicit operator bool() const {
+            return handlerId != 0;
+        }
+
+        /**
+         * @brief Unsubscribe the handler now and empty the handle.
+         */
+        void reset() {
+            if (handlerId == 0)
+                return;
+            if (auto token = loop.lock()) {
+                (*token)->unsubscribe(handlerId);
+            }
+            loop.reset();
+            handlerId = 0;
+        }
+
+        /**
+         * @brief Empty the handle without unsubscribing the handler.
+         * @return The handler ID, to be unsubscribed manually.
+         */
+        HandlerId release() {
+            loop.reset();
+            return std::exchange(handlerId, 0);
+        }
+    };
+
+    template <typename T, typename Handler>
+        requires(std::is_invocable_v<Handler &, const T &> || std::is_invocable_v<Handler &, std::shared_ptr<const T>>)
+    Subscription EventLoop::subscribeScoped(Handler &&handler, neko::Priority minPriority, neko::Priority handlerPriority) {
+        return Subscription(lifetime, subscribe<T>(std::forward<Handler>(handler), minPriority, handlerPriority));
+    }
+
 } // namespace neko::event
@@ -17,6 +17,7 @@
 #include <chrono>
 #include <thread>
 #include <atomic>
+#include <set>
 #include <vector>
 #include <string>
 
@@ -37,6 +38,40 @@ struct SimpleEvent {
     SimpleEvent(int d = 0) : data(d) {}
 };
 
+// Payload hierarchy for polymorphic dispatch
+struct NetworkEvent {
+    int connection = 0;
+};
+
+struct TcpEvent : NetworkEvent {
+    using EventBases = BaseTypes<NetworkEvent>;
+    int port = 0;
+};
+
+struct TlsEvent : TcpEvent {
+    using EventBases = BaseTypes<TcpEvent>;
+    std::string cipher;
+};
+
+// Numeric payload for bulk predicate filters
+struct Tick {
+    double price = 0.0;
+    float volume = 0.0f;
+    int venue = 0;
+};
+
+// Columnar payload stored field by field
+struct Quote {
+    neko::uint32 id = 0;
+    double price = 0.0;
+    neko::uint64 ts = 0;
+};
+
+template <>
+struct neko::event::ColumnLayout<Quote> {
+    static constexpr auto fields = std::make_tuple(&Quote::id, &Quote::price, &Quote::ts);
+};
+
 // Test filter class
 class TestFilter : public EventFilter<TestEvent> {
 private:
@@ -50,6 +85,18 @@ public:
     }
 };
 
+class SimpleFilter : public EventFilter<SimpleEvent> {
+private:
+    int minData;
+
+public:
+    SimpleFilter(int min) : minData(min) {}
+
+    bool shouldProcess(const SimpleEvent& eventData) override {
+        return eventData.data > minData;
+    }
+};
+
 // Test fixture
 class EventLoopTest : public ::testing::Test {
 protected:
@@ -316,6 +363,43 @@ TEST_F(EventLoopTest, RepeatingTask) {
     EXPECT_LE(finalCount, 6);  // Allow more variance
 }
 
+TEST_F(EventLoopTest, BusyRepeatingTasks) {
+    std::atomic<int> handled{0};
+    eventLoop->subscribe<TestEvent>([&handled](const TestEvent& event) { handled++; });
+
+    // A 0ms task, treated as 1ms, and a task slower than its interval leave room for events
+    std::atomic<int> fastRuns{0};
+    std::atomic<int> slowRuns{0};
+    eventLoop->scheduleRepeating(0, [&fastRuns]() { fastRuns++; });
+    eventLoop->scheduleRepeating(1, [&slowRuns]() {
+        slowRuns++;
+        std::this_thread::sleep_for(2ms);
+    });
+
+    std::thread loopThread([this]() {
+        eventLoop->run();
+    });
+    std::this_thread::sleep_for(20ms);
+    for (int i = 0; i < 10; ++i) {
+        eventLoop->publish(TestEvent{i, "busy"});
+    }
+    for (int i = 0; i < 200 && handled.load() < 10; ++i) {
+        std::this_thread::sleep_for(5ms);
+    }
+    EXPECT_EQ(handled.load(), 10);
+    EXPECT_GT(fastRuns.load(), 0);
+    EXPECT_GT(slowRuns.load(), 0);
+
+    // DrainAll runs each repeating task at most once more and returns
+    auto start = std::chrono::steady_clock::now();
+    int slowBefore = slowRuns.load();
+    eventLoop->stopLoop(ShutdownMode::DrainAll);
+    loopThread.join();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+    EXPECT_LE(slowRuns.load() - slowBefore, 2);
+    EXPECT_EQ(eventLoop->getState(), LoopState::Stopped);
+}
+
 // Delayed event publishing tests
 TEST_F(EventLoopTest, DelayedEventPublishing) {
     // This test has timing sensitivity issues, skip for now
@@ -416,7 +500,8 @@ TEST_F(EventLoopTest, QueueSizeTracking) {
     EXPECT_GT(stats.droppedEvents, 0);
 }
 
-// Exception handling tests
+// Exception handling tests, skipped when built with -fno-exceptions
+#if NEKO_EVENT_ENABLE_EXCEPTIONS
 TEST_F(EventLoopTest, ExceptionHandling) {
     std::atomic<bool> handlerExecuted{false};
     
@@ -448,6 +533,1350 @@ TEST_F(EventLoopTest, ExceptionHandling) {
     EXPECT_GT(stats.failedEvents, 0);
     EXPECT_GT(stats.processedEvents, 0);
 }
+#endif // NEKO_EVENT_ENABLE_EXCEPTIONS
+
+TEST_F(EventLoopTest, ErrorResultHandlers) {
+    eventLoop->resetStatistics();
+    std::atomic<int> okCount{0};
+
+    eventLoop->subscribe<SimpleEvent>([](const SimpleEvent& event) {
+        if (event.data < 0) {
+            return HandlerResult::failure("negative value");
+        }
+        return HandlerResult::ok();
+    });
+    eventLoop->subscribe<SimpleEvent>([](const SimpleEvent& event) {
+        return event.data < 0 ? HandlerResult::failure("also negative") : HandlerResult::ok();
+    });
+    eventLoop->subscribe<SimpleEvent>([&okCount](const SimpleEvent& event) {
+        okCount++;
+    });
+
+    std::vector<std::string> logs;
+    eventLoop->setLogger([&logs](const std::string& message) {
+        logs.push_back(message);
+    });
+
+    // Sync mode dispatches on the calling thread
+    eventLoop->publish(SimpleEvent{-1}, neko::Priority::Normal, neko::SyncMode::Sync);
+    eventLoop->publish(SimpleEvent{1}, neko::Priority::Normal, neko::SyncMode::Sync);
+
+    auto stats = eventLoop->getStatistics();
+    EXPECT_EQ(okCount.load(), 2);
+    EXPECT_EQ(stats.failedEvents, 1);
+    EXPECT_EQ(stats.failedHandlerCalls, 2);
+    EXPECT_EQ(stats.processedEvents, 1);
+    ASSERT_EQ(logs.size(), 2);
+    EXPECT_EQ(logs[0], "Event handler failed: negative value");
+}
+
+#if NEKO_EVENT_ENABLE_EXCEPTIONS
+TEST_F(EventLoopTest, DeadLetterQueue) {
+    eventLoop->setDeadLetterQueueSize(8);
+    eventLoop->setMaxQueueSize(1);
+
+    std::atomic<int> received{0};
+    auto handlerId = eventLoop->subscribe<SimpleEvent>([&received](const SimpleEvent& event) {
+        if (event.data == 42) {
+            throw std::runtime_error("bad payload");
+        }
+        received++;
+    });
+
+    // The second and third events overflow the queue
+    eventLoop->publish(SimpleEvent{1});
+    eventLoop->publish(SimpleEvent{2});
+    eventLoop->publish(SimpleEvent{3});
+    eventLoop->publish(SimpleEvent{42}, neko::Priority::Normal, neko::SyncMode::Sync);
+
+    auto letters = eventLoop->getDeadLetters();
+    ASSERT_EQ(letters.size(), 3);
+    EXPECT_EQ(letters[0].reason, DeadLetterReason::Overflow);
+    EXPECT_EQ(letters[2].reason, DeadLetterReason::Exception);
+    EXPECT_EQ(letters[2].handlerId, handlerId);
+    EXPECT_EQ(letters[2].message, "bad payload");
+    EXPECT_EQ(eventLoop->getQueueSizes().deadLetterQueueSize, 3);
+
+    // Retry the dropped events once there is room in the queue
+    eventLoop->setMaxQueueSize(100);
+    std::thread loopThread([this]() {
+        eventLoop->run();
+    });
+
+    EXPECT_EQ(eventLoop->retryDeadLetters(0, 1), 3);
+    std::this_thread::sleep_for(100ms);
+
+    eventLoop->stopLoop();
+    loopThread.join();
+
+    EXPECT_EQ(received.load(), 3);
+    // The failing event was retried once and stays in the queue afterwards
+    letters = eventLoop->getDeadLetters();
+    ASSERT_EQ(letters.size(), 1);
+    EXPECT_EQ(letters[0].attempts, 1);
+    EXPECT_EQ(eventLoop->retryDeadLetters(0, 1), 0);
+}
+#endif // NEKO_EVENT_ENABLE_EXCEPTIONS
+
+TEST_F(EventLoopTest, SharedPayloadFanOut) {
+    struct Frame {
+        std::vector<char> pixels;
+    };
+
+    EventLoop forwardLoop;
+    PayloadPool<Frame> pool(2);
+    std::vector<const Frame*> seen;
+    std::mutex seenMutex;
+
+    auto record = [&seen, &seenMutex](const Frame& frame) {
+        std::lock_guard<std::mutex> lock(seenMutex);
+        seen.push_back(&frame);
+    };
+    eventLoop->subscribe<Frame>(record);
+    forwardLoop.subscribe<Frame>(record);
+
+    // Forward the shared payload to another loop without copying it
+    eventLoop->subscribe<Frame>([&forwardLoop](std::shared_ptr<const Frame> frame) {
+        forwardLoop.publishShared(std::move(frame), neko::Priority::Normal, neko::SyncMode::Sync);
+    });
+
+    auto frame = pool.acquire();
+    frame->pixels.resize(1 << 20);
+    const Frame* address = frame.get();
+
+    eventLoop->publishShared<Frame>(std::move(frame), neko::Priority::Normal, neko::SyncMode::Sync);
+
+    ASSERT_EQ(seen.size(), 2);
+    EXPECT_EQ(seen[0], address);
+    EXPECT_EQ(seen[1], address);
+
+    // The last reader released the buffer back to the pool
+    EXPECT_EQ(pool.available(), 1);
+    auto reused = pool.acquire();
+    EXPECT_EQ(reused.get(), address);
+    EXPECT_EQ(reused->pixels.size(), 1u << 20);
+}
+
+TEST_F(EventLoopTest, MemoryBudgetedQueue) {
+    std::string small(16, 'a');
+    std::string large(4096, 'b');
+    auto smallBytes = sizeof(Event<std::string>) + PayloadSize<std::string>::of(small);
+    auto largeBytes = sizeof(Event<std::string>) + PayloadSize<std::string>::of(large);
+    EXPECT_GE(largeBytes, 4096u);
+
+    eventLoop->setMaxQueueBytes(largeBytes + smallBytes);
+    eventLoop->publish(large);
+    eventLoop->publish(small);
+    eventLoop->publish(small); // Over budget, dropped
+
+    auto sizes = eventLoop->getQueueSizes();
+    EXPECT_EQ(sizes.eventQueueSize, 2);
+    EXPECT_EQ(sizes.eventQueueBytes, largeBytes + smallBytes);
+    EXPECT_EQ(eventLoop->getStatistics().droppedEvents, 1);
+
+    // Evict queued events, oldest first, to make room for new ones
+    eventLoop->setOverflowPolicy(OverflowPolicy::DropOldest);
+    eventLoop->publish(small);
+    sizes = eventLoop->getQueueSizes();
+    EXPECT_EQ(sizes.eventQueueSize, 2);
+    EXPECT_EQ(sizes.eventQueueBytes, 2 * smallBytes);
+    EXPECT_EQ(eventLoop->getStatistics().droppedEvents, 2);
+
+    std::vector<std::size_t> received;
+    eventLoop->subscribe<std::string>([&received, this](const std::string& value) {
+        received.push_back(value.size());
+        if (received.size() == 2) {
+            eventLoop->stopLoop();
+        }
+    });
+    eventLoop->run();
+
+    EXPECT_EQ(received, (std::vector<std::size_t>{16, 16}));
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueBytes, 0);
+}
+
+TEST_F(EventLoopTest, HandlerOrderAndConsumption) {
+    std::vector<std::string> calls;
+
+    eventLoop->subscribe<SimpleEvent>([&calls](const SimpleEvent& event) {
+        calls.push_back("low");
+    }, neko::Priority::Low, neko::Priority::Low);
+    eventLoop->subscribe<SimpleEvent>([&calls](const SimpleEvent& event) {
+        calls.push_back("normal");
+    });
+    eventLoop->subscribe<SimpleEvent>([&calls](const SimpleEvent& event) {
+        calls.push_back("critical");
+        // Consume odd events so lower priority handlers never see them
+        return event.data % 2 ? HandlerResult::consumed() : HandlerResult::ok();
+    }, neko::Priority::Low, neko::Priority::Critical);
+
+    eventLoop->publish(SimpleEvent{2}, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_EQ(calls, (std::vector<std::string>{"critical", "normal", "low"}));
+
+    calls.clear();
+    eventLoop->publish(SimpleEvent{1}, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_EQ(calls, (std::vector<std::string>{"critical"}));
+    EXPECT_EQ(eventLoop->getStatistics().processedEvents, 2);
+}
+
+TEST_F(EventLoopTest, FrozenRegistry) {
+    std::atomic<int> simpleCount{0};
+    std::atomic<int> testCount{0};
+
+    eventLoop->registerEventType<SimpleEvent>();
+    eventLoop->subscribe<SimpleEvent>([&simpleCount](const SimpleEvent& event) {
+        simpleCount++;
+    });
+    eventLoop->freeze();
+    EXPECT_TRUE(eventLoop->isFrozen());
+
+    // Subscribing after freezing works for registered and new types
+    auto lateId = eventLoop->subscribe<SimpleEvent>([&simpleCount](const SimpleEvent& event) {
+        simpleCount += 10;
+    });
+    eventLoop->subscribe<TestEvent>([&testCount](const TestEvent& event) {
+        testCount++;
+    });
+
+    std::thread loopThread([this]() {
+        eventLoop->run();
+    });
+
+    eventLoop->publish(SimpleEvent{1});
+    eventLoop->publish(TestEvent{1, "late type"});
+    std::this_thread::sleep_for(50ms);
+
+    EXPECT_TRUE(eventLoop->unsubscribe<SimpleEvent>(lateId));
+    eventLoop->publish(SimpleEvent{2});
+    std::this_thread::sleep_for(50ms);
+
+    eventLoop->stopLoop();
+    loopThread.join();
+
+    EXPECT_EQ(simpleCount.load(), 12);
+    EXPECT_EQ(testCount.load(), 1);
+}
+
+TEST_F(EventLoopTest, HierarchyDispatch) {
+    std::vector<std::string> calls;
+
+    eventLoop->subscribe<NetworkEvent>([&calls](const NetworkEvent& event) {
+        calls.push_back("network " + std::to_string(event.connection));
+    }, neko::Priority::Low, neko::Priority::High);
+    eventLoop->subscribe<TlsEvent>([&calls](const TlsEvent& event) {
+        calls.push_back("tls " + event.cipher);
+    });
+
+    TlsEvent tls;
+    tls.connection = 7;
+    tls.port = 443;
+    tls.cipher = "aes";
+
+    // Base handlers subscribed after the derived type was registered are picked up too
+    auto tcpId = eventLoop->subscribe<TcpEvent>([&calls](const TcpEvent& event) {
+        calls.push_back("tcp " + std::to_string(event.port));
+    }, neko::Priority::Low, neko::Priority::Critical);
+
+    eventLoop->publish(tls, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_EQ(calls, (std::vector<std::string>{"tcp 443", "network 7", "tls aes"}));
+
+    // Derived events still reach the remaining base handlers after unsubscribing
+    calls.clear();
+    EXPECT_TRUE(eventLoop->unsubscribe<TcpEvent>(tcpId));
+    TcpEvent tcp;
+    tcp.connection = 3;
+    eventLoop->publish(tcp, neko::Priority::Normal, neko::SyncMode::Sync);
+    eventLoop->publish(NetworkEvent{1}, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_EQ(calls, (std::vector<std::string>{"network 3", "network 1"}));
+}
+
+TEST_F(EventLoopTest, BatchHandlers) {
+    std::vector<std::vector<int>> batches;
+    std::atomic<int> singleCount{0};
+
+    auto batchId = eventLoop->subscribeBatch<SimpleEvent>([&batches](std::span<const SimpleEvent> events) {
+        std::vector<int> values;
+        for (const auto& event : events) {
+            values.push_back(event.data);
+        }
+        batches.push_back(std::move(values));
+        // Data is laid out contiguously
+        EXPECT_EQ(&events.back() - &events.front(), static_cast<std::ptrdiff_t>(events.size()) - 1);
+    });
+    // Unfiltered handlers share one copy of the batch's payloads
+    std::vector<const SimpleEvent*> firstData;
+    std::vector<const SimpleEvent*> secondData;
+    eventLoop->subscribeBatch<SimpleEvent>([&firstData](std::span<const SimpleEvent> events) {
+        firstData.push_back(events.data());
+    });
+    eventLoop->subscribeBatch<SimpleEvent>([&secondData](std::span<const SimpleEvent> events) {
+        secondData.push_back(events.data());
+    });
+    eventLoop->subscribe<SimpleEvent>([&singleCount](const SimpleEvent& event) {
+        singleCount++;
+    });
+    eventLoop->subscribe<TestEvent>([this](const TestEvent& event) {
+        eventLoop->stopLoop();
+    });
+
+    eventLoop->setMaxBatchSize(4);
+    for (int i = 0; i < 6; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->publish(SimpleEvent{100}, neko::Priority::Low);
+    // Another event type ends the run of consecutive events
+    eventLoop->publish(TestEvent{0, "stop"});
+
+    auto filter = std::make_unique<SimpleFilter>(0);
+    EXPECT_TRUE(eventLoop->addFilter<SimpleEvent>(batchId, std::move(filter)));
+    eventLoop->run();
+
+    ASSERT_EQ(batches.size(), 2);
+    EXPECT_EQ(batches[0], (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(batches[1], (std::vector<int>{4, 5, 100}));
+    EXPECT_EQ(singleCount.load(), 7);
+    ASSERT_EQ(firstData.size(), 2);
+    EXPECT_EQ(firstData, secondData);
+
+    EXPECT_TRUE(eventLoop->unsubscribe<SimpleEvent>(batchId));
+    eventLoop->publish(SimpleEvent{1}, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_EQ(batches.size(), 2);
+}
+
+TEST_F(EventLoopTest, PredicateFilters) {
+    std::vector<Tick> ticks;
+    for (int i = 0; i < 103; ++i) {
+        ticks.push_back(Tick{i * 1.5, static_cast<float>(i % 7), i % 5});
+    }
+
+    auto predicate = (field(&Tick::price) >= 30.0 && field(&Tick::volume) < 4.0f) || field(&Tick::venue).in({3});
+    std::vector<neko::uint8> mask(ticks.size());
+    predicate.evaluate(ticks, mask.data());
+    for (std::size_t i = 0; i < ticks.size(); ++i) {
+        bool expected = (ticks[i].price >= 30.0 && ticks[i].volume < 4.0f) || ticks[i].venue == 3;
+        EXPECT_EQ(mask[i] != 0, expected) << "index " << i;
+        EXPECT_EQ(predicate.shouldProcess(ticks[i]), expected);
+    }
+
+    // Every comparison on an integer field, including lengths that leave a scalar tail
+    std::vector<neko::uint8> venueMask(ticks.size());
+    for (int venue = 0; venue < 5; ++venue) {
+        (field(&Tick::venue) <= venue).evaluate(ticks, venueMask.data());
+        for (std::size_t i = 0; i < ticks.size(); ++i) {
+            EXPECT_EQ(venueMask[i] != 0, ticks[i].venue <= venue);
+        }
+        (field(&Tick::venue) != venue).evaluate(std::span<const Tick>(ticks).first(13), venueMask.data());
+        for (std::size_t i = 0; i < 13; ++i) {
+            EXPECT_EQ(venueMask[i] != 0, ticks[i].venue != venue);
+        }
+    }
+
+    std::vector<double> prices;
+    auto batchId = eventLoop->subscribeBatch<Tick>([&prices](std::span<const Tick> batch) {
+        for (const auto& tick : batch) {
+            prices.push_back(tick.price);
+        }
+    });
+    EXPECT_TRUE(eventLoop->addFilter<Tick>(batchId, field(&Tick::price) > 100.0));
+
+    std::atomic<int> singleCount{0};
+    auto handlerId = eventLoop->subscribe<Tick>([&singleCount](const Tick& tick) {
+        singleCount++;
+    });
+    EXPECT_TRUE(eventLoop->addFilter<Tick>(handlerId, field(&Tick::venue) == 0));
+    eventLoop->subscribe<TestEvent>([this](const TestEvent& event) {
+        eventLoop->stopLoop();
+    });
+
+    for (const auto& tick : ticks) {
+        eventLoop->publish(tick);
+    }
+    eventLoop->publish(TestEvent{0, "stop"});
+    eventLoop->run();
+
+    std::vector<double> expectedPrices;
+    int expectedSingle = 0;
+    for (const auto& tick : ticks) {
+        if (tick.price > 100.0) {
+            expectedPrices.push_back(tick.price);
+        }
+        expectedSingle += tick.venue == 0;
+    }
+    EXPECT_EQ(prices, expectedPrices);
+    EXPECT_EQ(singleCount.load(), expectedSingle);
+}
+
+TEST_F(EventLoopTest, ColumnarBuffers) {
+    eventLoop->enableColumnar<Quote>();
+
+    std::vector<std::size_t> viewSizes;
+    std::vector<double> prices;
+    neko::uint64 idSum = 0;
+    eventLoop->subscribeColumns<Quote>([&](const ColumnView<Quote>& view) {
+        viewSizes.push_back(view.size());
+        auto priceColumn = view.column<&Quote::price>();
+        prices.insert(prices.end(), priceColumn.begin(), priceColumn.end());
+        for (auto id : view.column<0>()) {
+            idSum += id;
+        }
+        EXPECT_EQ(view.row(view.size() - 1).ts, view.column<&Quote::ts>().back());
+    });
+
+    std::vector<neko::uint64> timestamps;
+    auto rowHandlerId = eventLoop->subscribe<Quote>([&timestamps](const Quote& quote) {
+        timestamps.push_back(quote.ts);
+    });
+    eventLoop->subscribe<TestEvent>([this](const TestEvent& event) {
+        eventLoop->stopLoop();
+    });
+
+    for (neko::uint32 i = 1; i <= 100; ++i) {
+        eventLoop->publish(Quote{i, i * 0.5, i * 10ull});
+    }
+    // All buffered rows share one queue entry
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueSize, 1);
+    eventLoop->publish(TestEvent{0, "stop"});
+    eventLoop->run();
+
+    ASSERT_EQ(viewSizes, (std::vector<std::size_t>{100}));
+    EXPECT_EQ(prices.front(), 0.5);
+    EXPECT_EQ(prices.back(), 50.0);
+    EXPECT_EQ(idSum, 5050u);
+    ASSERT_EQ(timestamps.size(), 100u);
+    EXPECT_EQ(timestamps.back(), 1000u);
+
+    // Sync events reach column handlers as a single row
+    EXPECT_TRUE(eventLoop->unsubscribe<Quote>(rowHandlerId));
+    eventLoop->publish(Quote{7, 1.0, 70}, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_EQ(viewSizes.back(), 1u);
+    EXPECT_EQ(timestamps.size(), 100u);
+}
+
+TEST_F(EventLoopTest, EventTracing) {
+    std::vector<std::tuple<EventId, EventId, EventId>> simpleIds; // id, parent, root
+    EventId testId = 0;
+    EventId testRoot = 0;
+
+    eventLoop->subscribe<TestEvent>([this, &testId, &testRoot](const TestEvent& event) {
+        const BaseEvent* current = EventLoop::currentEvent();
+        ASSERT_NE(current, nullptr);
+        testId = current->id;
+        testRoot = current->rootId;
+        if (event.value == 1) {
+            eventLoop->publish(SimpleEvent{1});
+        }
+    });
+    eventLoop->subscribe<SimpleEvent>([this, &simpleIds](const SimpleEvent& event) {
+        const BaseEvent* current = EventLoop::currentEvent();
+        simpleIds.emplace_back(current->id, current->parentId, current->rootId);
+        if (event.data == 1) {
+            eventLoop->publish(SimpleEvent{2}, neko::Priority::Normal, neko::SyncMode::Sync);
+            eventLoop->stopLoop();
+        }
+    });
+
+    EXPECT_EQ(EventLoop::currentEvent(), nullptr);
+    eventLoop->publish(TestEvent{1, "root"});
+    eventLoop->run();
+
+    ASSERT_NE(testId, 0);
+    EXPECT_EQ(testRoot, testId);
+    ASSERT_EQ(simpleIds.size(), 2);
+    auto [childId, childParent, childRoot] = simpleIds[0];
+    auto [grandchildId, grandchildParent, grandchildRoot] = simpleIds[1];
+    EXPECT_NE(childId, testId);
+    EXPECT_EQ(childParent, testId);
+    EXPECT_EQ(childRoot, testId);
+    EXPECT_EQ(grandchildParent, childId);
+    EXPECT_EQ(grandchildRoot, testId);
+    EXPECT_EQ(EventLoop::currentEvent(), nullptr);
+
+    // IDs stay unique across threads
+    std::vector<EventId> ids(4000);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&ids, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                ids[t * 1000 + i] = detail::nextEventId();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+}
+
+TEST_F(EventLoopTest, CascadeLimits) {
+    eventLoop->setMaxCascadeDepth(3);
+    eventLoop->enableCycleDetection(true);
+    eventLoop->setDeadLetterQueueSize(4);
+
+    std::vector<int> seen;
+    std::vector<neko::uint32> depths;
+    // A feedback loop: every SimpleEvent publishes the next one
+    eventLoop->subscribe<SimpleEvent>([this, &seen, &depths](const SimpleEvent& event) {
+        seen.push_back(event.data);
+        depths.push_back(EventLoop::currentEvent()->depth);
+        eventLoop->publish(SimpleEvent{event.data + 1});
+    });
+    eventLoop->subscribe<TestEvent>([this](const TestEvent& event) {
+        if (event.value == 0) {
+            eventLoop->publish(SimpleEvent{0});
+        }
+    });
+
+    eventLoop->publish(TestEvent{0, "start"});
+    eventLoop->scheduleTask(100, [this]() { eventLoop->stopLoop(); });
+    eventLoop->run();
+
+    EXPECT_EQ(seen, (std::vector<int>{0, 1, 2}));
+    EXPECT_EQ(depths, (std::vector<neko::uint32>{1, 2, 3}));
+    auto stats = eventLoop->getStatistics();
+    EXPECT_EQ(stats.cascadeLimitedEvents, 1);
+    EXPECT_EQ(stats.maxCascadeDepth, 4u);
+    // SimpleEvent -> SimpleEvent is a cycle, TestEvent -> SimpleEvent is not
+    EXPECT_EQ(stats.cascadeCycles, 1);
+
+    auto letters = eventLoop->getDeadLetters();
+    ASSERT_EQ(letters.size(), 1);
+    EXPECT_EQ(letters[0].reason, DeadLetterReason::Cascade);
+    EXPECT_EQ(letters[0].event->depth, 4u);
+}
+
+TEST_F(EventLoopTest, PhasedDispatch) {
+    constexpr Phase preUpdate = 0;
+    constexpr Phase update = 1;
+
+    std::vector<std::string> order;
+    eventLoop->subscribe<TestEvent>([this, &order](const TestEvent& event) {
+        order.push_back(event.message);
+        // Published during the phase, dispatched by the next pump of that phase
+        if (event.message == "update") {
+            eventLoop->publishToPhase(update, TestEvent{0, "next frame"});
+        }
+    });
+
+    eventLoop->publishToPhase(update, TestEvent{0, "update"});
+    eventLoop->publishToPhase(preUpdate, TestEvent{0, "pre-update"});
+    EXPECT_EQ(eventLoop->getQueueSizes().phaseQueueSize, 2);
+
+    EXPECT_EQ(eventLoop->pump(preUpdate), 1);
+    EXPECT_EQ(eventLoop->pump(update), 1);
+    EXPECT_EQ(order, (std::vector<std::string>{"pre-update", "update"}));
+    EXPECT_EQ(eventLoop->pump(update), 1);
+    EXPECT_EQ(order.back(), "next frame");
+    EXPECT_EQ(eventLoop->pump(update), 0);
+
+    // Stepping the main queue
+    std::atomic<int> simpleCount{0};
+    eventLoop->subscribe<SimpleEvent>([this, &simpleCount](const SimpleEvent& event) {
+        simpleCount++;
+        if (event.data == 0) {
+            eventLoop->publish(SimpleEvent{1});
+        }
+    });
+    for (int i = 0; i < 5; ++i) {
+        eventLoop->publish(SimpleEvent{i + 10});
+    }
+    EXPECT_EQ(eventLoop->processAtMost(2), 2);
+    EXPECT_EQ(simpleCount.load(), 2);
+    EXPECT_EQ(eventLoop->processUntil(eventLoop->now() + std::chrono::seconds(1)), 3);
+    EXPECT_EQ(simpleCount.load(), 5);
+
+    // pump() leaves events published while pumping for the next call
+    eventLoop->publish(SimpleEvent{0});
+    EXPECT_EQ(eventLoop->pump(), 1);
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueSize, 1);
+    EXPECT_EQ(eventLoop->pump(), 1);
+    EXPECT_EQ(simpleCount.load(), 7);
+}
+
+TEST_F(EventLoopTest, TimeBudgetedPolling) {
+    std::vector<int> order;
+    std::vector<std::size_t> queued;
+    eventLoop->subscribe<SimpleEvent>([this, &order, &queued](const SimpleEvent& event) {
+        order.push_back(event.data);
+        queued.push_back(eventLoop->getQueueSizes().eventQueueSize);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    });
+
+    eventLoop->publish(SimpleEvent{1}, neko::Priority::Low);
+    eventLoop->publish(SimpleEvent{2}, neko::Priority::Normal);
+    eventLoop->publish(SimpleEvent{3}, neko::Priority::Critical);
+    eventLoop->publish(SimpleEvent{4}, neko::Priority::High);
+
+    // A zero budget leaves all work queued
+    EXPECT_EQ(eventLoop->pollOnce(std::chrono::nanoseconds(0)), 0);
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueSize, 4);
+
+    // Highest priority first; leftovers keep their order at the front of the queue
+    auto processed = eventLoop->pollOnce(std::chrono::milliseconds(7), true);
+    ASSERT_GE(processed, 1);
+    ASSERT_LT(processed, 4);
+    EXPECT_EQ(order.front(), 3);
+    // The other events stay queued, visible to other threads, while one is dispatched
+    EXPECT_EQ(queued.front(), 3u);
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueSize, 4 - processed);
+
+    eventLoop->publish(SimpleEvent{5});
+    std::atomic<bool> taskRan{false};
+    eventLoop->scheduleTask(10, [&taskRan]() { taskRan = true; });
+    auto start = std::chrono::steady_clock::now();
+    eventLoop->runFor(std::chrono::milliseconds(60));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(60));
+    EXPECT_TRUE(taskRan.load());
+    ASSERT_EQ(order.size(), 5);
+    EXPECT_TRUE(std::is_sorted(order.begin() + processed, order.end()));
+    EXPECT_EQ(order.back(), 5);
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueSize, 0);
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueBytes, 0);
+}
+
+TEST_F(EventLoopTest, ManualClockScheduling) {
+    auto clock = std::make_shared<ManualClock>();
+    eventLoop->setClock(clock);
+
+    int ticks = 0;
+    std::atomic<bool> eventReceived{false};
+    eventLoop->subscribe<TestEvent>([&eventReceived](const TestEvent& event) {
+        eventReceived = true;
+    });
+    auto repeatingId = eventLoop->scheduleRepeating(1000, [&ticks]() { ticks++; });
+    eventLoop->publishAfter(50, TestEvent{42, "Delayed event"});
+
+    // Nothing is due until the clock moves, however long we wait
+    eventLoop->pump();
+    EXPECT_EQ(ticks, 0);
+    EXPECT_FALSE(eventReceived.load());
+
+    EXPECT_TRUE(eventLoop->advanceTime(std::chrono::milliseconds(50)));
+    eventLoop->pump(); // Runs the publishing task
+    eventLoop->pump(); // Dispatches the published event
+    EXPECT_TRUE(eventReceived.load());
+
+    // An hour of timer activity, simulated one second at a time
+    auto start = std::chrono::steady_clock::now();
+    for (int second = 0; second < 3600; ++second) {
+        eventLoop->advanceTime(std::chrono::seconds(1));
+        eventLoop->pump();
+    }
+    EXPECT_EQ(ticks, 3600);
+
+    // A jump runs the task once and skips the missed intervals, keeping its phase
+    eventLoop->advanceTime(std::chrono::milliseconds(10450));
+    eventLoop->pump();
+    EXPECT_EQ(ticks, 3601);
+    eventLoop->advanceTime(std::chrono::milliseconds(499));
+    eventLoop->pump();
+    EXPECT_EQ(ticks, 3601);
+    eventLoop->advanceTime(std::chrono::milliseconds(1));
+    eventLoop->pump();
+    EXPECT_EQ(ticks, 3602);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+    EXPECT_EQ(eventLoop->now(), clock->now());
+
+    EXPECT_TRUE(eventLoop->cancelTask(repeatingId));
+    eventLoop->advanceTime(std::chrono::seconds(10));
+    eventLoop->pump();
+    EXPECT_EQ(ticks, 3602);
+
+    // processUntil() deadlines are on the scheduler clock, here moved by the handler
+    std::vector<int> values;
+    eventLoop->subscribe<SimpleEvent>([this, &values](const SimpleEvent& event) {
+        values.push_back(event.data);
+        eventLoop->advanceTime(std::chrono::milliseconds(3));
+    });
+    for (int i = 0; i < 4; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    EXPECT_EQ(eventLoop->processUntil(eventLoop->now() + std::chrono::milliseconds(4)), 2);
+    EXPECT_EQ(eventLoop->processUntil(eventLoop->now()), 0);
+    EXPECT_EQ(eventLoop->processUntil(eventLoop->now() + std::chrono::hours(1)), 2);
+    EXPECT_EQ(values, (std::vector<int>{0, 1, 2, 3}));
+
+    eventLoop->setClock(std::make_shared<SteadyClock>());
+    EXPECT_FALSE(eventLoop->advanceTime(std::chrono::seconds(1)));
+}
+
+TEST_F(EventLoopTest, TimestampSources) {
+    TimePoint stamped{};
+    eventLoop->subscribe<SimpleEvent>([&stamped](const SimpleEvent& event) {
+        stamped = EventLoop::currentEvent()->timestamp;
+    });
+
+    eventLoop->setTimestampSource(TimestampSource::None);
+    eventLoop->publish(SimpleEvent{1}, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_EQ(stamped, TimePoint{});
+    EXPECT_EQ(eventLoop->getStatistics().processedEvents, 1);
+
+    for (auto source : {TimestampSource::Coarse, TimestampSource::Tsc, TimestampSource::Steady}) {
+        eventLoop->setTimestampSource(source);
+        auto before = std::chrono::steady_clock::now();
+        eventLoop->publish(SimpleEvent{1}, neko::Priority::Normal, neko::SyncMode::Sync);
+        auto after = std::chrono::steady_clock::now();
+        // Every source is on the steady_clock timeline, within its resolution
+        EXPECT_GT(stamped, before - std::chrono::milliseconds(20));
+        EXPECT_LT(stamped, after + std::chrono::milliseconds(20));
+    }
+}
+
+TEST_F(EventLoopTest, GracefulShutdown) {
+    eventLoop->setDeadLetterQueueSize(16);
+    ShutdownMode mode = ShutdownMode::Immediate;
+    std::chrono::milliseconds drainTimeout{0};
+    std::vector<int> seen;
+
+    eventLoop->subscribe<TestEvent>([this, &mode, &drainTimeout](const TestEvent& event) {
+        eventLoop->stopLoop(mode, drainTimeout);
+    });
+    eventLoop->subscribe<SimpleEvent>([this, &seen](const SimpleEvent& event) {
+        seen.push_back(event.data);
+        if (event.data == 2) {
+            eventLoop->publish(SimpleEvent{3}); // Published while draining
+            eventLoop->scheduleTask(0, [this]() { eventLoop->publish(SimpleEvent{4}); });
+        }
+        if (event.data >= 10) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    });
+
+    // Immediate: queued events are discarded and reported
+    eventLoop->publish(TestEvent{0, "stop"});
+    eventLoop->publish(SimpleEvent{1});
+    eventLoop->publish(SimpleEvent{2});
+    eventLoop->run();
+    EXPECT_TRUE(seen.empty());
+    EXPECT_EQ(eventLoop->getStatistics().discardedEvents, 2);
+    auto letters = eventLoop->takeDeadLetters();
+    ASSERT_EQ(letters.size(), 2);
+    EXPECT_EQ(letters[0].reason, DeadLetterReason::Expired);
+
+    // The loop can be restarted; Drain processes queued events and cascades, not tasks
+    eventLoop->restart();
+    mode = ShutdownMode::Drain;
+    eventLoop->publish(TestEvent{0, "stop"});
+    eventLoop->publish(SimpleEvent{1});
+    eventLoop->publish(SimpleEvent{2});
+    eventLoop->run();
+    EXPECT_EQ(seen, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(eventLoop->getStatistics().discardedEvents, 2);
+
+    // DrainAll also runs due tasks: the one left by the previous run publishes first, behind the queued event
+    seen.clear();
+    eventLoop->restart();
+    mode = ShutdownMode::DrainAll;
+    eventLoop->publish(TestEvent{0, "stop"});
+    eventLoop->publish(SimpleEvent{2});
+    eventLoop->run();
+    EXPECT_EQ(seen, (std::vector<int>{2, 4, 3, 4}));
+
+    // Draining stops at the timeout
+    seen.clear();
+    eventLoop->restart();
+    mode = ShutdownMode::Drain;
+    drainTimeout = std::chrono::milliseconds(50);
+    eventLoop->publish(TestEvent{0, "stop"});
+    for (int i = 10; i < 20; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->run();
+    EXPECT_GE(seen.size(), 1);
+    EXPECT_LT(seen.size(), 10);
+    EXPECT_EQ(eventLoop->getStatistics().discardedEvents, 2 + 10 - seen.size());
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueSize, 0);
+}
+
+TEST_F(EventLoopTest, LoopLifecycle) {
+    EXPECT_EQ(eventLoop->getState(), LoopState::Created);
+    EXPECT_FALSE(eventLoop->isRunning());
+
+    std::atomic<int> handled{0};
+    std::mutex threadsMutex;
+    std::set<std::thread::id> threads;
+    eventLoop->subscribe<SimpleEvent>([&](const SimpleEvent& event) {
+        {
+            std::lock_guard<std::mutex> lock(threadsMutex);
+            threads.insert(std::this_thread::get_id());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        handled++;
+    });
+
+    // Worker mode: several threads run the same loop
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 3; ++i) {
+        workers.emplace_back([this]() { eventLoop->run(); });
+    }
+    while (eventLoop->getRunnerCount() < 3) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(eventLoop->isRunning());
+    EXPECT_EQ(eventLoop->getState(), LoopState::Running);
+    for (int i = 0; i < 60; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->stopLoop(ShutdownMode::Drain);
+    EXPECT_FALSE(eventLoop->isRunning());
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_EQ(eventLoop->getState(), LoopState::Stopped);
+    EXPECT_FALSE(eventLoop->isRunning());
+    EXPECT_EQ(handled.load(), 60);
+    EXPECT_GE(threads.size(), 1);
+
+    // A worker starting after the stop returns at once and leaves queued events alone
+    eventLoop->publish(SimpleEvent{0});
+    eventLoop->run();
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueSize, 1);
+    EXPECT_EQ(eventLoop->getState(), LoopState::Stopped);
+
+    // The same loop object is reused after restart()
+    eventLoop->restart();
+    std::thread worker([this]() { eventLoop->run(); });
+    while (handled.load() < 61) {
+        std::this_thread::yield();
+    }
+    eventLoop->stopLoop();
+    worker.join();
+    EXPECT_EQ(eventLoop->getState(), LoopState::Stopped);
+}
+
+TEST_F(EventLoopTest, SubscriptionHandles) {
+    int scoped = 0;
+    {
+        auto subscription = eventLoop->subscribeScoped<SimpleEvent>([&scoped](const SimpleEvent& event) {
+            scoped++;
+        });
+        EXPECT_TRUE(subscription);
+        eventLoop->publish(SimpleEvent{1});
+        eventLoop->pump();
+
+        // Moving transfers ownership, the moved-from handle does nothing
+        auto moved = std::move(subscription);
+        EXPECT_FALSE(subscription);
+        EXPECT_NE(moved.id(), 0);
+        eventLoop->publish(SimpleEvent{2});
+        eventLoop->pump();
+    }
+    eventLoop->publish(SimpleEvent{3});
+    eventLoop->pump();
+    EXPECT_EQ(scoped, 2);
+
+    // Untyped unsubscribe finds event, batch and column handlers alike
+    eventLoop->enableColumnar<Quote>();
+    int rows = 0, batches = 0, columns = 0;
+    auto rowId = eventLoop->subscribe<Quote>([&rows](const Quote& quote) { rows++; });
+    auto batchId = eventLoop->subscribeBatch<Quote>([&batches](std::span<const Quote> quotes) { batches++; });
+    auto columnId = eventLoop->subscribeColumns<Quote>([&columns](const ColumnView<Quote>& view) { columns++; });
+    EXPECT_FALSE(eventLoop->unsubscribe<SimpleEvent>(rowId));
+    EXPECT_TRUE(eventLoop->unsubscribe(rowId));
+    EXPECT_FALSE(eventLoop->unsubscribe(rowId));
+    EXPECT_TRUE(eventLoop->unsubscribe(batchId));
+    EXPECT_TRUE(eventLoop->unsubscribe<Quote>(columnId));
+    eventLoop->publish(Quote{1, 1.0, 1});
+    eventLoop->pump();
+    EXPECT_EQ(rows + batches + columns, 0);
+
+    // Removal in any order keeps the remaining handlers in priority order
+    std::vector<int> order;
+    std::vector<HandlerId> ids;
+    for (int i = 0; i < 100; ++i) {
+        ids.push_back(eventLoop->subscribe<SimpleEvent>([&order, i](const SimpleEvent& event) {
+            order.push_back(i);
+        }, neko::Priority::Low, i % 2 ? neko::Priority::High : neko::Priority::Normal));
+    }
+    for (int i = 0; i < 100; ++i) {
+        if (i % 3 != 0) {
+            EXPECT_TRUE(eventLoop->unsubscribe(ids[i]));
+        }
+    }
+    eventLoop->publish(SimpleEvent{4});
+    eventLoop->pump();
+    std::vector<int> expected;
+    for (int i = 3; i < 100; i += 6) {
+        expected.push_back(i);
+    }
+    for (int i = 0; i < 100; i += 6) {
+        expected.push_back(i);
+    }
+    EXPECT_EQ(order, expected);
+
+    // A handle outliving its loop is harmless
+    auto orphan = eventLoop->subscribeScoped<SimpleEvent>([](const SimpleEvent& event) {});
+    eventLoop.reset();
+    orphan.reset();
+    EXPECT_FALSE(orphan);
+    eventLoop = std::make_unique<EventLoop>();
+}
+
+TEST_F(EventLoopTest, SubscriptionScaling) {
+    // Subscribing and unsubscribing stay amortized O(1), the snapshot is rebuilt once per dispatch
+    constexpr int count = 40000;
+    std::atomic<int> calls{0};
+    std::vector<HandlerId> ids;
+    ids.reserve(count);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i) {
+        ids.push_back(eventLoop->subscribe<TestEvent>([&calls](const TestEvent& event) { calls++; }));
+    }
+    eventLoop->publish(TestEvent{1, "all"}, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_EQ(calls.load(), count);
+
+    // Short-lived subscriptions churning next to the long-lived ones
+    for (int i = 0; i < count; ++i) {
+        auto id = eventLoop->subscribe<TestEvent>([](const TestEvent& event) {});
+        EXPECT_TRUE(eventLoop->unsubscribe(id));
+    }
+    for (int i = 0; i < count; i += 2) {
+        EXPECT_TRUE(eventLoop->unsubscribe(ids[i]));
+    }
+    calls = 0;
+    eventLoop->publish(TestEvent{2, "half"}, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_EQ(calls.load(), count / 2);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 5s);
+}
+
+TEST_F(EventLoopTest, DeferredReclamation) {
+    // A handler unsubscribing itself is not called for the events still queued
+    int selfCalls = 0;
+    HandlerId selfId = 0;
+    selfId = eventLoop->subscribe<SimpleEvent>([&](const SimpleEvent& event) {
+        selfCalls++;
+        EXPECT_TRUE(eventLoop->unsubscribe(selfId));
+    });
+    for (int i = 0; i < 5; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->pump();
+    EXPECT_EQ(selfCalls, 1);
+
+    // Handlers are destroyed only once no dispatch can still reach them
+    auto token = std::make_shared<int>(0);
+    std::weak_ptr<int> observer = token;
+    std::atomic<int> calls{0};
+    auto handlerId = eventLoop->subscribe<SimpleEvent>([token, &calls](const SimpleEvent& event) {
+        calls++;
+    });
+    token.reset();
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 3; ++i) {
+        workers.emplace_back([this]() { eventLoop->run(); });
+    }
+    while (eventLoop->getRunnerCount() < 3) {
+        std::this_thread::yield();
+    }
+    std::thread publisher([this]() {
+        for (int i = 0; i < 2000; ++i) {
+            eventLoop->publish(SimpleEvent{i});
+        }
+    });
+    while (calls.load() < 100) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(eventLoop->unsubscribe(handlerId));
+    auto callsAfterUnsubscribe = calls.load();
+    publisher.join();
+    eventLoop->stopLoop(ShutdownMode::Drain);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    // At most the invocations already in progress complete after unsubscribing
+    EXPECT_LE(calls.load(), callsAfterUnsubscribe + 3);
+
+    // Any later dispatch reclaims the retired handler lists
+    eventLoop->publish(SimpleEvent{0});
+    eventLoop->pump();
+    EXPECT_TRUE(observer.expired());
+}
+
+TEST_F(EventLoopTest, LimitedSubscriptions) {
+    std::vector<int> once;
+    auto onceId = eventLoop->subscribeOnce<SimpleEvent>([&once](const SimpleEvent& event) {
+        once.push_back(event.data);
+    });
+
+    // Filtered events do not use up invocations, so this waits for the first three values above 10
+    std::vector<int> limited;
+    auto limitedId = eventLoop->subscribeN<SimpleEvent>(3, [&limited](const SimpleEvent& event) {
+        limited.push_back(event.data);
+    });
+    EXPECT_TRUE(eventLoop->addFilter<SimpleEvent>(limitedId, field(&SimpleEvent::data) > 10));
+    EXPECT_EQ(eventLoop->subscribeN<SimpleEvent>(0, [](const SimpleEvent& event) {}), 0);
+
+    for (int i = 0; i < 20; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->pump();
+    EXPECT_EQ(once, (std::vector<int>{0}));
+    EXPECT_EQ(limited, (std::vector<int>{11, 12, 13}));
+    // Both removed themselves from the registry
+    EXPECT_FALSE(eventLoop->unsubscribe(onceId));
+    EXPECT_FALSE(eventLoop->unsubscribe(limitedId));
+
+    // Exactly N invocations with several workers
+    std::atomic<int> calls{0};
+    eventLoop->subscribeN<SimpleEvent>(50, [&calls](const SimpleEvent& event) { calls++; });
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 3; ++i) {
+        workers.emplace_back([this]() { eventLoop->run(); });
+    }
+    while (eventLoop->getRunnerCount() < 3) {
+        std::this_thread::yield();
+    }
+    for (int i = 0; i < 500; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->stopLoop(ShutdownMode::Drain);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(calls.load(), 50);
+}
+
+TEST_F(EventLoopTest, OwnerBoundSubscriptions) {
+    struct Listener {
+        std::vector<int> values;
+        int failures = 0;
+        void onEvent(const SimpleEvent& event) { values.push_back(event.data); }
+        HandlerResult onChecked(const SimpleEvent& event) {
+            if (event.data < 0) {
+                failures++;
+                return HandlerResult::failure("negative");
+            }
+            return HandlerResult::ok();
+        }
+    };
+
+    auto listener = std::make_shared<Listener>();
+    auto handlerId = eventLoop->subscribe<SimpleEvent>(std::weak_ptr<Listener>(listener), &Listener::onEvent);
+    eventLoop->subscribe<SimpleEvent>(std::weak_ptr<Listener>(listener), &Listener::onChecked);
+    EXPECT_TRUE(eventLoop->addFilter<SimpleEvent>(handlerId, field(&SimpleEvent::data) != 2));
+
+    for (int i = 0; i < 4; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->publish(SimpleEvent{-1});
+    eventLoop->pump();
+    // The handler does not keep the owner alive
+    EXPECT_EQ(listener.use_count(), 1);
+    EXPECT_EQ(listener->values, (std::vector<int>{0, 1, 3, -1}));
+    EXPECT_EQ(listener->failures, 1);
+
+    // Handlers of a destroyed owner are skipped and pruned
+    auto failedBefore = eventLoop->getStatistics().failedHandlerCalls;
+    listener.reset();
+    eventLoop->publish(SimpleEvent{-2});
+    eventLoop->pump();
+    EXPECT_EQ(eventLoop->getStatistics().failedHandlerCalls, failedBefore);
+    EXPECT_FALSE(eventLoop->unsubscribe(handlerId));
+}
+
+TEST_F(EventLoopTest, StreamOperators) {
+    using namespace std::chrono_literals;
+    auto clock = std::make_shared<ManualClock>();
+    eventLoop->setClock(clock);
+    auto step = [this](std::chrono::milliseconds duration) {
+        eventLoop->advanceTime(duration);
+        eventLoop->pump();
+    };
+
+    // Tumbling and sliding windows, events arriving at a window's end belong to the next one
+    std::vector<std::size_t> tumbling, sliding;
+    auto tumblingId = eventLoop->subscribeWindow<SimpleEvent>(100ms, 0ms, [&tumbling](std::span<const SimpleEvent> events) {
+        tumbling.push_back(events.size());
+    });
+    auto slidingId = eventLoop->subscribeWindow<SimpleEvent>(100ms, 50ms, [&sliding](std::span<const SimpleEvent> events) {
+        sliding.push_back(events.size());
+    });
+    for (int i = 0; i < 3; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->pump();
+    step(50ms);
+    eventLoop->publish(SimpleEvent{3});
+    eventLoop->pump();
+    step(50ms);
+    step(50ms);
+    step(50ms);
+    EXPECT_EQ(tumbling, (std::vector<std::size_t>{4, 0}));
+    EXPECT_EQ(sliding, (std::vector<std::size_t>{3, 4, 1, 0}));
+    // Unsubscribing stops the window timers
+    EXPECT_TRUE(eventLoop->unsubscribe(slidingId));
+    step(100ms);
+    EXPECT_EQ(tumbling, (std::vector<std::size_t>{4, 0, 0}));
+    EXPECT_EQ(sliding.size(), 4);
+    EXPECT_TRUE(eventLoop->unsubscribe(tumblingId));
+
+    // Debounce delivers the last event of a burst after a quiet period
+    std::vector<int> debounced;
+    auto debouncedId = eventLoop->subscribeDebounced<SimpleEvent>(30ms, [&debounced](const SimpleEvent& event) {
+        debounced.push_back(event.data);
+    });
+    eventLoop->publish(SimpleEvent{1});
+    eventLoop->pump();
+    step(20ms);
+    eventLoop->publish(SimpleEvent{2});
+    eventLoop->pump();
+    step(20ms);
+    EXPECT_TRUE(debounced.empty());
+    step(20ms);
+    EXPECT_EQ(debounced, (std::vector<int>{2}));
+    EXPECT_TRUE(eventLoop->unsubscribe(debouncedId));
+
+    // Throttle lets the first event of each interval through
+    std::vector<int> throttled;
+    auto throttledId = eventLoop->subscribeThrottled<SimpleEvent>(100ms, [&throttled](const SimpleEvent& event) {
+        throttled.push_back(event.data);
+    });
+    for (int i = 0; i < 5; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->pump();
+    step(50ms);
+    eventLoop->publish(SimpleEvent{5});
+    eventLoop->pump();
+    step(60ms);
+    eventLoop->publish(SimpleEvent{6});
+    eventLoop->pump();
+    EXPECT_EQ(throttled, (std::vector<int>{0, 6}));
+    EXPECT_TRUE(eventLoop->unsubscribe(throttledId));
+
+    // Sample delivers the latest event per interval, if any
+    std::vector<int> sampled;
+    auto sampledId = eventLoop->subscribeSampled<SimpleEvent>(100ms, [&sampled](const SimpleEvent& event) {
+        sampled.push_back(event.data);
+    });
+    eventLoop->publish(SimpleEvent{1});
+    eventLoop->publish(SimpleEvent{2});
+    eventLoop->pump();
+    step(100ms);
+    step(100ms);
+    eventLoop->publish(SimpleEvent{3});
+    eventLoop->pump();
+    step(100ms);
+    EXPECT_EQ(sampled, (std::vector<int>{2, 3}));
+    EXPECT_TRUE(eventLoop->unsubscribe(sampledId));
+
+    // Buffers are delivered when full or when their oldest event is too old
+    std::vector<std::vector<int>> buffers;
+    eventLoop->subscribeBuffered<SimpleEvent>(3, 50ms, [&buffers](std::span<const SimpleEvent> events) {
+        std::vector<int> values;
+        for (const auto& event : events) {
+            values.push_back(event.data);
+        }
+        buffers.push_back(std::move(values));
+    });
+    EXPECT_EQ(eventLoop->subscribeBuffered<SimpleEvent>(0, 0ms, [](std::span<const SimpleEvent> events) {}), 0);
+    for (int i = 1; i <= 7; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->pump();
+    EXPECT_EQ(buffers.size(), 2);
+    step(50ms);
+    ASSERT_EQ(buffers.size(), 3);
+    EXPECT_EQ(buffers[0], (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(buffers[2], (std::vector<int>{7}));
+}
+
+TEST_F(EventLoopTest, RateLimits) {
+    using namespace std::chrono_literals;
+    auto clock = std::make_shared<ManualClock>();
+    eventLoop->setClock(clock);
+    eventLoop->setDeadLetterQueueSize(100);
+
+    int simpleCount = 0, testCount = 0, tickCount = 0;
+    eventLoop->subscribe<SimpleEvent>([&simpleCount](const SimpleEvent& event) { simpleCount++; });
+    eventLoop->subscribe<TestEvent>([&testCount](const TestEvent& event) { testCount++; });
+    eventLoop->subscribe<Tick>([&tickCount](const Tick& tick) { tickCount++; });
+
+    // Reject: a burst of 3, then one event per 100 ms
+    eventLoop->setRateLimit<SimpleEvent>({10.0, 3, RateLimitPolicy::Reject});
+    for (int i = 0; i < 5; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->pump();
+    EXPECT_EQ(simpleCount, 3);
+    eventLoop->advanceTime(100ms);
+    eventLoop->publish(SimpleEvent{5});
+    eventLoop->publish(SimpleEvent{6}, neko::Priority::Normal, neko::SyncMode::Sync);
+    eventLoop->pump();
+    EXPECT_EQ(simpleCount, 4);
+    auto deadLetters = eventLoop->getDeadLetters();
+    ASSERT_EQ(deadLetters.size(), 3);
+    EXPECT_EQ(deadLetters.front().reason, DeadLetterReason::RateLimited);
+
+    // Drop: only counted
+    eventLoop->setRateLimit<TestEvent>({10.0, 1, RateLimitPolicy::Drop});
+    for (int i = 0; i < 3; ++i) {
+        eventLoop->publish(TestEvent{i, "drop"});
+    }
+    eventLoop->pump();
+    EXPECT_EQ(testCount, 1);
+    EXPECT_EQ(eventLoop->getDeadLetters().size(), 3);
+
+    // Delay: deferred up to the maximum delay, beyond it rejected
+    eventLoop->setRateLimit<Tick>({10.0, 1, RateLimitPolicy::Delay, 250ms});
+    for (int i = 0; i < 5; ++i) {
+        eventLoop->publish(Tick{static_cast<double>(i)});
+    }
+    eventLoop->pump();
+    EXPECT_EQ(tickCount, 1);
+    for (int i = 0; i < 2; ++i) {
+        eventLoop->advanceTime(100ms);
+        eventLoop->pump(); // Queues the deferred event
+        eventLoop->pump();
+    }
+    EXPECT_EQ(tickCount, 3);
+
+    auto stats = eventLoop->getStatistics();
+    EXPECT_EQ(stats.rateLimitedEvents, 3 + 2 + 2);
+    EXPECT_EQ(stats.delayedEvents, 2);
+
+    // Per-handler limit: only the limited handler skips events
+    eventLoop->setRateLimit<SimpleEvent>({0.0});
+    int limitedCount = 0;
+    auto limitedId = eventLoop->subscribe<SimpleEvent>([&limitedCount](const SimpleEvent& event) { limitedCount++; });
+    EXPECT_TRUE(eventLoop->setHandlerRateLimit(limitedId, 10.0, 2));
+    EXPECT_FALSE(eventLoop->setHandlerRateLimit(12345, 10.0));
+    simpleCount = 0;
+    for (int i = 0; i < 5; ++i) {
+        eventLoop->publish(SimpleEvent{i});
+    }
+    eventLoop->pump();
+    EXPECT_EQ(simpleCount, 5);
+    EXPECT_EQ(limitedCount, 2);
+    EXPECT_EQ(eventLoop->getStatistics().rateLimitedCalls, 3);
+}
+
+TEST_F(EventLoopTest, LazyPayloads) {
+    std::atomic<int> built{0};
+    auto factory = [&built]() {
+        built++;
+        return TestEvent(7, "lazy");
+    };
+
+    // Nothing subscribed, nothing published or built
+    EXPECT_FALSE(eventLoop->hasSubscribers<TestEvent>());
+    EXPECT_FALSE(eventLoop->publishLazy<TestEvent>(factory));
+    eventLoop->pump();
+    EXPECT_EQ(built.load(), 0);
+
+    // Handlers requiring a higher priority do not read the payload
+    std::vector<int> urgent;
+    auto urgentId = eventLoop->subscribe<TestEvent>([&urgent](const TestEvent& event) {
+        urgent.push_back(event.value);
+    }, neko::Priority::High);
+    EXPECT_TRUE(eventLoop->hasSubscribers<TestEvent>());
+    EXPECT_TRUE(eventLoop->publishLazy<TestEvent>(factory, neko::Priority::Low));
+    eventLoop->pump();
+    EXPECT_EQ(built.load(), 0);
+    EXPECT_TRUE(urgent.empty());
+
+    // Built once and shared by all handlers
+    std::vector<const TestEvent*> seen;
+    std::string message;
+    auto sharedId = eventLoop->subscribe<TestEvent>([&seen, &message](std::shared_ptr<const TestEvent> event) {
+        seen.push_back(event.get());
+        message = event->message;
+    });
+    auto plainId = eventLoop->subscribe<TestEvent>([&seen](const TestEvent& event) { seen.push_back(&event); });
+    EXPECT_TRUE(eventLoop->publishLazy<TestEvent>(factory, neko::Priority::High));
+    eventLoop->pump();
+    EXPECT_EQ(built.load(), 1);
+    EXPECT_EQ(urgent, (std::vector<int>{7}));
+    ASSERT_EQ(seen.size(), 2u);
+    EXPECT_EQ(seen[0], seen[1]);
+    EXPECT_EQ(message, "lazy");
+
+    // Synchronous dispatch builds on the publishing thread
+    EXPECT_TRUE(eventLoop->publishLazy<TestEvent>(factory, neko::Priority::High, neko::SyncMode::Sync));
+    EXPECT_EQ(built.load(), 2);
+
+    // Unsubscribed between publish and dispatch
+    eventLoop->unsubscribe(urgentId);
+    eventLoop->unsubscribe(sharedId);
+    EXPECT_TRUE(eventLoop->publishLazy<TestEvent>(factory));
+    eventLoop->unsubscribe(plainId);
+    EXPECT_FALSE(eventLoop->hasSubscribers<TestEvent>());
+    eventLoop->pump();
+    EXPECT_EQ(built.load(), 2);
+
+    // Handlers of a base type and batch handlers count as subscribers
+    EXPECT_FALSE(eventLoop->hasSubscribers<TlsEvent>());
+    std::atomic<int> baseSeen{0};
+    auto baseId = eventLoop->subscribe<NetworkEvent>([&baseSeen](const NetworkEvent& event) { baseSeen++; });
+    EXPECT_TRUE(eventLoop->hasSubscribers<TlsEvent>());
+    EXPECT_TRUE(eventLoop->publishLazy<TlsEvent>([] { return TlsEvent{}; }));
+    eventLoop->pump();
+    EXPECT_EQ(baseSeen.load(), 1);
+    eventLoop->unsubscribe(baseId);
+    EXPECT_FALSE(eventLoop->hasSubscribers<TlsEvent>());
+
+    // A base-type handler rejecting the priority does not build the payload
+    bool tlsBuilt = false;
+    auto highId = eventLoop->subscribe<NetworkEvent>([&baseSeen](const NetworkEvent& event) { baseSeen++; },
+                                                     neko::Priority::High);
+    EXPECT_TRUE(eventLoop->publishLazy<TlsEvent>([&tlsBuilt] {
+        tlsBuilt = true;
+        return TlsEvent{};
+    }, neko::Priority::Low));
+    eventLoop->pump();
+    EXPECT_FALSE(tlsBuilt);
+    EXPECT_EQ(baseSeen.load(), 1);
+    eventLoop->unsubscribe(highId);
+    auto batchId = eventLoop->subscribeBatch<TlsEvent>([](std::span<const TlsEvent> events) {});
+    EXPECT_TRUE(eventLoop->hasSubscribers<TlsEvent>());
+    eventLoop->unsubscribe(batchId);
+    EXPECT_FALSE(eventLoop->hasSubscribers<TlsEvent>());
+
+    // Handlers expiring by themselves stop counting at once, before the loop removes them
+    eventLoop->subscribeOnce<TcpEvent>([](const TcpEvent& event) {});
+    EXPECT_TRUE(eventLoop->hasSubscribers<TlsEvent>());
+    eventLoop->publish(TcpEvent{}, neko::Priority::Normal, neko::SyncMode::Sync);
+    EXPECT_FALSE(eventLoop->hasSubscribers<TcpEvent>());
+    EXPECT_FALSE(eventLoop->hasSubscribers<TlsEvent>());
+}
+
+TEST_F(EventLoopTest, ColumnarCascadeLimits) {
+    eventLoop->setMaxCascadeDepth(2);
+    eventLoop->setDeadLetterQueueSize(4);
+    eventLoop->enableColumnar<Quote>();
+
+    std::vector<neko::uint32> ids;
+    eventLoop->subscribeColumns<Quote>([&ids](const ColumnView<Quote>& view) {
+        auto idColumn = view.column<&Quote::id>();
+        ids.insert(ids.end(), idColumn.begin(), idColumn.end());
+    });
+    // Each TestEvent publishes a row one level deeper than itself, and the next TestEvent
+    eventLoop->subscribe<TestEvent>([this](const TestEvent& event) {
+        eventLoop->publish(Quote{static_cast<neko::uint32>(event.value)});
+        if (event.value < 3) {
+            eventLoop->publish(TestEvent{event.value + 1, "next"});
+        }
+    });
+
+    eventLoop->publish(TestEvent{0, "start"});
+    eventLoop->pump();
+    eventLoop->pump();
+    // The row at depth 3 is rejected without blocking later flushes
+    eventLoop->publish(Quote{10});
+    eventLoop->pump();
+
+    std::sort(ids.begin(), ids.end());
+    EXPECT_EQ(ids, (std::vector<neko::uint32>{0, 1, 10}));
+    EXPECT_EQ(eventLoop->getStatistics().cascadeLimitedEvents, 2);
+    auto letters = eventLoop->getDeadLetters();
+    ASSERT_EQ(letters.size(), 2);
+    EXPECT_EQ(letters[0].reason, DeadLetterReason::Cascade);
+    EXPECT_EQ(letters[0].event->getType(), std::type_index(typeid(Quote)));
+    EXPECT_EQ(eventLoop->getQueueSizes().eventQueueSize, 0);
+}
 
 /*
  * Test Summary:
@@ -460,10 +1889,38 @@ TEST_F(EventLoopTest, ExceptionHandling) {
  *  BasicTaskScheduling - Tests basic task scheduling functionality
  *  TaskCancellation - Tests task cancellation
  *  RepeatingTask - Tests repeating task functionality
+ *  BusyRepeatingTasks - Tests that zero-interval and slow repeating tasks leave room for events and shutdown
  *  DelayedEventPublishing - Temporarily disabled due to timing sensitivity
  *  EventStatistics - Tests event processing statistics
  *  QueueSizeTracking - Tests queue size limits and tracking
  *  ExceptionHandling - Tests exception handling in event processing
+ *  ErrorResultHandlers - Tests handlers reporting errors through HandlerResult
+ *  DeadLetterQueue - Tests dead-lettering of dropped and failed events and retries
+ *  SharedPayloadFanOut - Tests zero-copy shared payloads and payload pooling
+ *  MemoryBudgetedQueue - Tests byte budget accounting and overflow policies
+ *  HandlerOrderAndConsumption - Tests handler priority ordering and consumed events
+ *  FrozenRegistry - Tests event type pre-registration and registry freezing
+ *  HierarchyDispatch - Tests delivery of derived payloads to base type handlers
+ *  BatchHandlers - Tests batched delivery of consecutive events as spans
+ *  PredicateFilters - Tests bulk-evaluated field predicates on batch and single handlers
+ *  ColumnarBuffers - Tests structure-of-arrays buffering and column handlers
+ *  EventTracing - Tests event ID assignment and parent/root propagation
+ *  CascadeLimits - Tests cascade depth limiting and type cycle detection
+ *  PhasedDispatch - Tests phase queues and the step API (pump, processUntil, processAtMost)
+ *  TimeBudgetedPolling - Tests pollOnce and runFor with time budgets and priority order
+ *  ManualClockScheduling - Tests deterministic scheduling with a manual clock
+ *  TimestampSources - Tests the configurable event timestamp sources
+ *  GracefulShutdown - Tests shutdown modes, drain timeouts and restarting the loop
+ *  LoopLifecycle - Tests lifecycle states and running one loop from several worker threads
+ *  SubscriptionHandles - Tests RAII subscription handles and unsubscribing by handler ID
+ *  SubscriptionScaling - Tests that subscribing and unsubscribing many handlers stays linear
+ *  DeferredReclamation - Tests unsubscribing during dispatch and epoch-based handler reclamation
+ *  LimitedSubscriptions - Tests one-shot and N-shot subscriptions
+ *  OwnerBoundSubscriptions - Tests member function handlers bound to a weakly held owner
+ *  StreamOperators - Tests windows, debounce, throttle, sample and buffers on a manual clock
+ *  RateLimits - Tests per-type publish rate limits (reject, drop, delay) and per-handler limits
+ *  LazyPayloads - Tests lazily built payloads and subscriber queries
+ *  ColumnarCascadeLimits - Tests columnar rows published from handlers at and beyond the cascade limit
  */
 
 int main(int argc, char** argv) {